@@ -0,0 +1,16 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <cstdint>
+
+// Counts every operator new in the process and charges it to the active
+// Profiler's innermost scope. alloc_tracker.cpp replaces the global
+// allocation functions, so it is linked into the game executable only; the
+// headless tools keep the default allocator.
+class AllocTracker {
+public:
+    static uint64_t getAllocationCount();
+    static uint64_t getAllocatedBytes();
+};
+
+#endif // ALLOC_TRACKER_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "arena.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+
+Arena::Arena(size_t blockSize, size_t retainLimit)
+    : blockSize(blockSize), retainLimit(retainLimit), usedBefore(0), offset(0), highWater(0), depth(0) {}
+
+Arena::~Arena() {
+    releaseBlocks();
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    if (!blocks.empty()) {
+        const Block& block = blocks.back();
+        uintptr_t address = reinterpret_cast<uintptr_t>(block.data) + offset;
+        size_t padding = (alignment - address % alignment) % alignment;
+        if (padding + size <= block.size - offset) {
+            offset += padding + size;
+            highWater = std::max(highWater, getUsedBytes());
+            return block.data + offset - size;
+        }
+    }
+
+    // Blocks come from operator new, aligned for any fundamental type; the
+    // slack covers anything stricter.
+    addBlock(size + alignment);
+    return allocate(size, alignment);
+}
+
+const char* Arena::format(const char* format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    va_list measure;
+    va_copy(measure, arguments);
+    int length = std::vsnprintf(nullptr, 0, format, measure);
+    va_end(measure);
+
+    char* text = static_cast<char*>(allocate(length > 0 ? static_cast<size_t>(length) + 1 : 1, 1));
+    if (length > 0) {
+        std::vsnprintf(text, static_cast<size_t>(length) + 1, format, arguments);
+    } else {
+        text[0] = '\0';
+    }
+    va_end(arguments);
+    return text;
+}
+
+void Arena::reset() {
+    if (blocks.size() > 1 || (!blocks.empty() && blocks.back().size > std::max(blockSize, retainLimit))) {
+        // Fold the chain into one block big enough for this workload, unless
+        // that would hold on to more than retainLimit.
+        size_t total = 0;
+        for (const Block& block : blocks) total += block.size;
+        releaseBlocks();
+        addBlock(total <= retainLimit ? total : blockSize);
+    }
+    usedBefore = 0;
+    offset = 0;
+}
+
+size_t Arena::getCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : blocks) capacity += block.size;
+    return capacity;
+}
+
+void Arena::addBlock(size_t minimumSize) {
+    if (!blocks.empty()) usedBefore += offset;
+    size_t size = std::max(blockSize, minimumSize);
+    blocks.push_back({static_cast<unsigned char*>(::operator new(size)), size});
+    offset = 0;
+}
+
+void Arena::releaseBlocks() {
+    for (const Block& block : blocks) {
+        ::operator delete(block.data);
+    }
+    blocks.clear();
+    usedBefore = 0;
+    offset = 0;
+}
+
+Arena& Arena::frame() {
+    static thread_local Arena arena(FRAME_BLOCK_SIZE, FRAME_RETAIN_LIMIT);
+    return arena;
+}
+
+Arena& Arena::load() {
+    static thread_local Arena arena(LOAD_BLOCK_SIZE, LOAD_RETAIN_LIMIT);
+    return arena;
+}
@@ -0,0 +1,117 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Bump-pointer allocator for short-lived scratch memory. Allocating is a
+// pointer bump and nothing is freed on its own; reset() releases everything
+// at once. A full block chains another from the heap, and the next reset()
+// folds the chain into a single block of the combined size (up to
+// retainLimit), so a steady workload settles on one block and stops touching
+// the heap.
+//
+// Every thread has its own frame() arena, reset at the end of Game::draw, and
+// load() arena, reset when the outermost Scope on it ends.
+class Arena {
+public:
+    Arena(size_t blockSize, size_t retainLimit);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    // printf into the arena; the text lives until the next reset().
+    const char* format(const char* format, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 2, 3)))
+#endif
+        ;
+    void reset();
+
+    // Bytes handed out since the last reset(), and the most ever.
+    size_t getUsedBytes() const { return usedBefore + offset; }
+    size_t getHighWater() const { return highWater; }
+    // Bytes currently held from the heap.
+    size_t getCapacity() const;
+
+    static constexpr size_t FRAME_BLOCK_SIZE = 64 * 1024;
+    static constexpr size_t FRAME_RETAIN_LIMIT = 1024 * 1024;
+    static constexpr size_t LOAD_BLOCK_SIZE = 256 * 1024;
+    static constexpr size_t LOAD_RETAIN_LIMIT = 4 * 1024 * 1024;
+
+    static Arena& frame();
+    static Arena& load();
+
+    // Resets the arena when the outermost Scope on it ends, so nested
+    // parsers can share one arena and everything goes at once.
+    class Scope {
+    public:
+        explicit Scope(Arena& arena) : arena(arena) { arena.depth++; }
+        ~Scope() {
+            if (--arena.depth == 0) arena.reset();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Arena& arena;
+    };
+
+private:
+    struct Block {
+        unsigned char* data;
+        size_t size;
+    };
+
+    void addBlock(size_t minimumSize);
+    void releaseBlocks();
+
+    size_t blockSize;
+    size_t retainLimit;
+    std::vector<Block> blocks;
+    // Bytes used in the blocks before the last one, and in the last one.
+    size_t usedBefore;
+    size_t offset;
+    size_t highWater;
+    int depth;
+};
+
+// Standard allocator over an Arena: deallocate() is a no-op, the memory goes
+// back with the arena's next reset. Containers using it must not outlive that.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) : arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}
+
+    Arena* getArena() const { return arena; }
+
+private:
+    Arena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return !(a == b);
+}
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+#endif // ARENA_H
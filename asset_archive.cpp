@@ -0,0 +1,160 @@
+#include "asset_archive.h"
+#include "trace.h"
+#include <cstring>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const char* const AssetArchive::DEFAULT_PATH = "data/assets.pak";
+
+AssetArchive::AssetArchive() : base(nullptr), length(0), entries(nullptr), entryCount(0) {}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const std::string& filename) {
+    close();
+
+#if defined(_WIN32)
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    fallbackBuffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(fallbackBuffer.data()), static_cast<std::streamsize>(fallbackBuffer.size()));
+    base = fallbackBuffer.data();
+    length = fallbackBuffer.size();
+#else
+    int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0) return false;
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || info.st_size <= 0) {
+        ::close(descriptor);
+        return false;
+    }
+    void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) return false;
+    base = static_cast<const unsigned char*>(mapping);
+    length = static_cast<size_t>(info.st_size);
+#endif
+
+    const Header* header = reinterpret_cast<const Header*>(base);
+    if (length < sizeof(Header) || std::memcmp(header->magic, "PAK1", 4) != 0 || header->version != VERSION ||
+        length < sizeof(Header) + header->entryCount * sizeof(Entry)) {
+        TraceLog(LOG_WARNING, "ASSETS: %s is not a valid asset archive", filename.c_str());
+        close();
+        return false;
+    }
+
+    entryCount = header->entryCount;
+    entries = reinterpret_cast<const Entry*>(base + sizeof(Header));
+    for (uint32_t i = 0; i < entryCount; i++) {
+        if (entries[i].offset + entries[i].size > length) {
+            TraceLog(LOG_WARNING, "ASSETS: %s has a truncated entry", filename.c_str());
+            close();
+            return false;
+        }
+    }
+
+    TraceLog(LOG_INFO, "ASSETS: Mapped %s (%u entries, %zu bytes)", filename.c_str(), entryCount, length);
+    return true;
+}
+
+void AssetArchive::close() {
+#if !defined(_WIN32)
+    if (base && fallbackBuffer.empty()) {
+        munmap(const_cast<unsigned char*>(base), length);
+    }
+#endif
+    fallbackBuffer.clear();
+    base = nullptr;
+    length = 0;
+    entries = nullptr;
+    entryCount = 0;
+}
+
+const AssetArchive::Entry* AssetArchive::find(const std::string& name, EntryType type) const {
+    for (uint32_t i = 0; i < entryCount; i++) {
+        if (entries[i].type == type && std::strncmp(entries[i].name, name.c_str(), sizeof(entries[i].name)) == 0) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+std::string AssetArchive::fontKey(const std::string& path, int fontSize) {
+    return path + "@" + std::to_string(fontSize);
+}
+
+Texture2D AssetArchive::loadTexture(const std::string& path) const {
+    TRACE_SCOPE("load texture", "assets", path.c_str());
+    const Entry* entry = find(path, IMAGE_ENTRY);
+    if (!entry) {
+        return LoadTexture(path.c_str());
+    }
+
+    Image image = {
+        const_cast<unsigned char*>(blob(*entry)),
+        static_cast<int>(entry->params[0]),
+        static_cast<int>(entry->params[1]),
+        1,
+        static_cast<int>(entry->params[2])
+    };
+    return LoadTextureFromImage(image);
+}
+
+Font AssetArchive::loadFont(const std::string& path, int fontSize, int glyphCount) const {
+    TRACE_SCOPE("load font", "assets", path.c_str());
+    const Entry* entry = find(fontKey(path, fontSize), FONT_ENTRY);
+    if (!entry || static_cast<int>(entry->params[1]) != glyphCount) {
+        return LoadFontEx(path.c_str(), fontSize, nullptr, glyphCount);
+    }
+
+    Font font = {};
+    font.baseSize = static_cast<int>(entry->params[0]);
+    font.glyphCount = static_cast<int>(entry->params[1]);
+    font.glyphPadding = static_cast<int>(entry->params[2]);
+
+    // UnloadFont() releases these with the raylib allocator.
+    font.glyphs = static_cast<GlyphInfo*>(MemAlloc(font.glyphCount * sizeof(GlyphInfo)));
+    font.recs = static_cast<Rectangle*>(MemAlloc(font.glyphCount * sizeof(Rectangle)));
+
+    const GlyphRecord* records = reinterpret_cast<const GlyphRecord*>(blob(*entry));
+    for (int i = 0; i < font.glyphCount; i++) {
+        font.glyphs[i] = {records[i].value, records[i].offsetX, records[i].offsetY, records[i].advanceX, {}};
+        font.recs[i] = records[i].rec;
+    }
+
+    Image atlas = {
+        const_cast<unsigned char*>(blob(*entry) + font.glyphCount * sizeof(GlyphRecord)),
+        static_cast<int>(entry->params[3]),
+        static_cast<int>(entry->params[4]),
+        1,
+        static_cast<int>(entry->params[5])
+    };
+    font.texture = LoadTextureFromImage(atlas);
+    return font;
+}
+
+Sound AssetArchive::loadSound(const std::string& path) const {
+    TRACE_SCOPE("load sound", "assets", path.c_str());
+    const Entry* entry = find(path, WAVE_ENTRY);
+    if (!entry) {
+        return LoadSound(path.c_str());
+    }
+
+    Wave wave = {
+        entry->params[0],
+        entry->params[1],
+        entry->params[2],
+        entry->params[3],
+        const_cast<unsigned char*>(blob(*entry))
+    };
+    return LoadSoundFromWave(wave);
+}
\ No newline at end of file
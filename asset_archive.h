@@ -0,0 +1,75 @@
+#ifndef ASSET_ARCHIVE_H
+#define ASSET_ARCHIVE_H
+
+#include "raylib.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Single-file asset pack produced at build time by tools/asset_packer.cpp.
+// Images are stored as decoded pixels, fonts as pre-rasterized atlases and
+// sounds as PCM, so loading is a lookup in the memory-mapped file followed by
+// a GPU/audio upload. Any asset missing from the pack is loaded from disk.
+class AssetArchive {
+public:
+    static const char* const DEFAULT_PATH;
+    static const uint32_t VERSION = 1;
+
+    enum EntryType : uint32_t {
+        IMAGE_ENTRY = 1,
+        FONT_ENTRY = 2,
+        WAVE_ENTRY = 3
+    };
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+
+    // params: image {width, height, format}
+    //         font  {baseSize, glyphCount, glyphPadding, atlasWidth, atlasHeight, atlasFormat}
+    //         wave  {frameCount, sampleRate, sampleSize, channels}
+    struct Entry {
+        char name[60];
+        uint32_t type;
+        uint32_t params[6];
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct GlyphRecord {
+        int32_t value;
+        int32_t offsetX;
+        int32_t offsetY;
+        int32_t advanceX;
+        Rectangle rec;
+    };
+
+    AssetArchive();
+    ~AssetArchive();
+
+    bool open(const std::string& filename);
+    void close();
+    bool isOpen() const { return base != nullptr; }
+
+    Texture2D loadTexture(const std::string& path) const;
+    Font loadFont(const std::string& path, int fontSize, int glyphCount) const;
+    Sound loadSound(const std::string& path) const;
+
+    static std::string fontKey(const std::string& path, int fontSize);
+
+private:
+    const Entry* find(const std::string& name, EntryType type) const;
+    const unsigned char* blob(const Entry& entry) const { return base + entry.offset; }
+
+    const unsigned char* base;
+    size_t length;
+    const Entry* entries;
+    uint32_t entryCount;
+    std::vector<unsigned char> fallbackBuffer;
+};
+
+#endif // ASSET_ARCHIVE_H
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "benchmark_report.h"
+#include <algorithm>
+
+namespace {
+
+const double PERCENTILES[] = {0.50, 0.90, 0.99, 0.999};
+const char* const PERCENTILE_NAMES[] = {"p50", "p90", "p99", "p99.9"};
+
+}
+
+BenchmarkReport::BenchmarkReport(size_t expectedFrames)
+    : totalSeconds(0.0), stateSeconds(), stateFrames(), allocations(0), allocatedBytes(0), maxFrameAllocations(0),
+      framesWithoutAllocations(0) {
+    // Reserved up front so recording a frame never allocates.
+    frameSeconds.reserve(expectedFrames);
+}
+
+void BenchmarkReport::addFrame(double seconds, Simulation::GameState state, uint64_t frameAllocations,
+                               uint64_t frameBytes) {
+    if (frameSeconds.size() < frameSeconds.capacity()) {
+        frameSeconds.push_back(static_cast<float>(seconds));
+    }
+    totalSeconds += seconds;
+    stateSeconds[state] += seconds;
+    stateFrames[state]++;
+    allocations += frameAllocations;
+    allocatedBytes += frameBytes;
+    maxFrameAllocations = std::max(maxFrameAllocations, frameAllocations);
+    if (frameAllocations == 0) framesWithoutAllocations++;
+}
+
+double BenchmarkReport::percentileMs(double fraction) const {
+    if (frameSeconds.empty()) return 0.0;
+    std::vector<float> sorted = frameSeconds;
+    auto nth = sorted.begin() + static_cast<std::ptrdiff_t>(fraction * (sorted.size() - 1));
+    std::nth_element(sorted.begin(), nth, sorted.end());
+    return *nth * 1e3;
+}
+
+void BenchmarkReport::print(FILE* file) const {
+    size_t frames = frameSeconds.size();
+    std::fprintf(file, "BENCHMARK %zu frames in %.3f s (%.1f fps)\n", frames, totalSeconds,
+                 totalSeconds > 0.0 ? frames / totalSeconds : 0.0);
+
+    std::fprintf(file, "frame time:");
+    for (size_t i = 0; i < sizeof(PERCENTILES) / sizeof(PERCENTILES[0]); i++) {
+        std::fprintf(file, " %s %.3f ms", PERCENTILE_NAMES[i], percentileMs(PERCENTILES[i]));
+    }
+    std::fprintf(file, " max %.3f ms\n", percentileMs(1.0));
+
+    for (int state = 0; state < STATE_COUNT; state++) {
+        if (stateFrames[state] == 0) continue;
+        std::fprintf(file, "  %-24s %8llu frames %9.3f s (%5.1f%%)\n",
+                     Simulation::getStateName(static_cast<Simulation::GameState>(state)),
+                     static_cast<unsigned long long>(stateFrames[state]), stateSeconds[state],
+                     totalSeconds > 0.0 ? 100.0 * stateSeconds[state] / totalSeconds : 0.0);
+    }
+
+    std::fprintf(file, "allocations: %llu (%llu bytes), %.2f per frame, max %llu in one frame, %llu frames without\n",
+                 static_cast<unsigned long long>(allocations), static_cast<unsigned long long>(allocatedBytes),
+                 frames > 0 ? static_cast<double>(allocations) / frames : 0.0,
+                 static_cast<unsigned long long>(maxFrameAllocations),
+                 static_cast<unsigned long long>(framesWithoutAllocations));
+}
+
+bool BenchmarkReport::writeJson(const std::string& filename) const {
+    FILE* file = std::fopen(filename.c_str(), "w");
+    if (!file) return false;
+
+    std::fprintf(file, "{\n  \"frames\": %zu,\n  \"seconds\": %.6f,\n  \"frame_time_ms\": {", frameSeconds.size(),
+                 totalSeconds);
+    for (size_t i = 0; i < sizeof(PERCENTILES) / sizeof(PERCENTILES[0]); i++) {
+        std::fprintf(file, "\"%s\": %.4f, ", PERCENTILE_NAMES[i], percentileMs(PERCENTILES[i]));
+    }
+    std::fprintf(file, "\"max\": %.4f},\n  \"states\": {", percentileMs(1.0));
+
+    bool first = true;
+    for (int state = 0; state < STATE_COUNT; state++) {
+        if (stateFrames[state] == 0) continue;
+        std::fprintf(file, "%s\n    \"%s\": {\"frames\": %llu, \"seconds\": %.6f}", first ? "" : ",",
+                     Simulation::getStateName(static_cast<Simulation::GameState>(state)),
+                     static_cast<unsigned long long>(stateFrames[state]), stateSeconds[state]);
+        first = false;
+    }
+    std::fprintf(file, "\n  },\n  \"allocations\": {\"count\": %llu, \"bytes\": %llu, \"max_per_frame\": %llu, "
+                       "\"frames_without\": %llu}\n}\n",
+                 static_cast<unsigned long long>(allocations), static_cast<unsigned long long>(allocatedBytes),
+                 static_cast<unsigned long long>(maxFrameAllocations),
+                 static_cast<unsigned long long>(framesWithoutAllocations));
+    return std::fclose(file) == 0;
+}
\ No newline at end of file
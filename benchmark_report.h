@@ -0,0 +1,37 @@
+#ifndef BENCHMARK_REPORT_H
+#define BENCHMARK_REPORT_H
+
+#include "simulation.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Results of a --benchmark run: the distribution of whole-frame times, the
+// time spent in each game state and the heap allocations made per frame.
+class BenchmarkReport {
+public:
+    explicit BenchmarkReport(size_t expectedFrames);
+
+    void addFrame(double seconds, Simulation::GameState state, uint64_t allocations, uint64_t allocatedBytes);
+
+    void print(FILE* file) const;
+    bool writeJson(const std::string& filename) const;
+
+private:
+    static const int STATE_COUNT = Simulation::LEVEL_TRANSITION_STATE + 1;
+
+    double percentileMs(double fraction) const;
+
+    std::vector<float> frameSeconds;
+    double totalSeconds;
+    double stateSeconds[STATE_COUNT];
+    uint64_t stateFrames[STATE_COUNT];
+    uint64_t allocations;
+    uint64_t allocatedBytes;
+    uint64_t maxFrameAllocations;
+    uint64_t framesWithoutAllocations;
+};
+
+#endif // BENCHMARK_REPORT_H
\ No newline at end of file
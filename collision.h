@@ -0,0 +1,13 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "raylib.h"
+
+// Same test as raylib's CheckCollisionRecs(), kept here so the simulation
+// only needs raylib's plain data types and never links against raylib.
+inline bool rectanglesOverlap(Rectangle first, Rectangle second) {
+    return first.x < second.x + second.width && first.x + first.width > second.x &&
+           first.y < second.y + second.height && first.y + first.height > second.y;
+}
+
+#endif // COLLISION_H
\ No newline at end of file
@@ -0,0 +1,149 @@
+#ifndef EMBEDDED_LEVELS_H
+#define EMBEDDED_LEVELS_H
+
+#include "embedded_levels_rll.h"
+#include "globals.h"
+#include <array>
+#include <cstddef>
+#include <utility>
+
+// data/levels.rll embedded by the build (see CMakeLists.txt) and decoded by
+// the compiler into read-only tile arrays, so the fallback levels can never
+// drift from the shipped pack. Follows LevelPack::fromString() and
+// LevelPack::decodeLayout(); a malformed pack fails the build instead of
+// throwing at runtime.
+namespace EmbeddedLevels {
+
+constexpr size_t TEXT_LENGTH = sizeof(EMBEDDED_LEVELS_RLL) - 1;
+
+struct Range {
+    size_t begin;
+    size_t end;
+};
+
+struct Dimensions {
+    size_t rows;
+    size_t columns;
+};
+
+constexpr size_t lineEnd(size_t position) {
+    while (position < TEXT_LENGTH && EMBEDDED_LEVELS_RLL[position] != '\n') position++;
+    return position;
+}
+
+constexpr bool isSeparatorLine(size_t begin, size_t end) {
+    if (end > begin && EMBEDDED_LEVELS_RLL[end - 1] == '\r') end--;
+    return begin == end || EMBEDDED_LEVELS_RLL[begin] == ';';
+}
+
+// Text of the index-th level; levels are separated by blank or ';' comment
+// lines and may span several lines. Returns an empty range past the last.
+constexpr Range levelText(int index) {
+    int level = -1;
+    bool inLevel = false;
+    Range range = {TEXT_LENGTH, TEXT_LENGTH};
+    for (size_t begin = 0; begin < TEXT_LENGTH; begin = lineEnd(begin) + 1) {
+        size_t end = lineEnd(begin);
+        if (isSeparatorLine(begin, end)) {
+            if (inLevel && level == index) return range;
+            inLevel = false;
+            continue;
+        }
+        if (!inLevel) {
+            inLevel = true;
+            level++;
+            range.begin = begin;
+        }
+        range.end = end;
+    }
+    return inLevel && level == index ? range : Range{TEXT_LENGTH, TEXT_LENGTH};
+}
+
+constexpr int countLevels() {
+    int count = 0;
+    while (levelText(count).begin < TEXT_LENGTH) count++;
+    return count;
+}
+
+constexpr bool isTile(char c) {
+    return c == WALL || c == WALL_DARK || c == AIR || c == SPIKE || c == PLAYER || c == ENEMY || c == COIN ||
+           c == EXIT;
+}
+
+// Walks one level and either measures it or, when cells is non-null, writes
+// its rows into a buffer already filled with air.
+constexpr Dimensions walkLevel(int index, char* cells, size_t stride) {
+    Range range = levelText(index);
+    Dimensions size = {1, 0};
+    size_t column = 0;
+    size_t count = 0;
+    bool hasCount = false;
+    char last = '\0';
+    for (size_t i = range.begin; i < range.end; i++) {
+        char c = EMBEDDED_LEVELS_RLL[i];
+        if (c == '\n' || c == '\r') continue;
+        last = c;
+        if (c >= '0' && c <= '9') {
+            count = count * 10 + static_cast<size_t>(c - '0');
+            hasCount = true;
+        } else if (c == '|') {
+            if (hasCount) throw "data/levels.rll: run length before row separator";
+            size.rows++;
+            column = 0;
+        } else if (isTile(c)) {
+            if (hasCount && count == 0) throw "data/levels.rll: zero run length";
+            size_t run = hasCount ? count : 1;
+            for (size_t j = 0; j < run; j++, column++) {
+                if (cells) cells[(size.rows - 1) * stride + column] = c;
+            }
+            if (column > size.columns) size.columns = column;
+            count = 0;
+            hasCount = false;
+        } else {
+            throw "data/levels.rll: unknown tile";
+        }
+    }
+    if (hasCount) throw "data/levels.rll: run length at end of level";
+    // A trailing separator does not start another row.
+    if (size.rows > 1 && last == '|') size.rows--;
+    if (size.columns == 0) throw "data/levels.rll: invalid level dimensions";
+    return size;
+}
+
+constexpr Dimensions measure(int index) {
+    return walkLevel(index, nullptr, 0);
+}
+
+template <int Index>
+constexpr auto decode() {
+    constexpr Dimensions size = measure(Index);
+    std::array<char, size.rows * size.columns> cells = {};
+    for (char& cell : cells) cell = AIR;
+    walkLevel(Index, cells.data(), size.columns);
+    return cells;
+}
+
+constexpr int LEVEL_COUNT_IN_PACK = countLevels();
+static_assert(LEVEL_COUNT_IN_PACK >= LEVEL_COUNT, "data/levels.rll has fewer levels than LEVEL_COUNT");
+
+struct Level {
+    size_t rows;
+    size_t columns;
+    const char* cells;
+};
+
+template <int Index>
+inline constexpr std::array<char, measure(Index).rows * measure(Index).columns> CELLS = decode<Index>();
+
+template <int... Index>
+constexpr std::array<Level, sizeof...(Index)> table(std::integer_sequence<int, Index...>) {
+    return {{{measure(Index).rows, measure(Index).columns, CELLS<Index>.data()}...}};
+}
+
+// Every level of the pack, in order.
+inline constexpr std::array<Level, LEVEL_COUNT_IN_PACK> LEVELS =
+    table(std::make_integer_sequence<int, LEVEL_COUNT_IN_PACK>());
+
+}
+
+#endif // EMBEDDED_LEVELS_H
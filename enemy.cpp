@@ -4,8 +4,15 @@
 
 Enemy::Enemy(Vector2 pos, bool lookingRight)
     : position(pos)
+    , previousPosition(pos)
     , lookingRight(lookingRight) {}
 
+void Enemy::setState(const State& state) {
+    position = state.position;
+    previousPosition = state.previousPosition;
+    lookingRight = state.lookingRight;
+}
+
 void Enemy::update(Level* level) {
     float nextX = position.x + (lookingRight ? MOVEMENT_SPEED : -MOVEMENT_SPEED);
 
@@ -8,16 +8,28 @@ class Level;
 
 class Enemy {
 public:
+    struct State {
+        Vector2 position;
+        Vector2 previousPosition;
+        bool lookingRight;
+    };
+
     Enemy(Vector2 pos, bool lookingRight = true);
 
+    State getState() const { return {position, previousPosition, lookingRight}; }
+    void setState(const State& state);
+
+    void beginTick() { previousPosition = position; }
     void update(Level* level);
     Vector2 getPosition() const;
+    Vector2 getPreviousPosition() const { return previousPosition; }
     bool isLookingRight() const;
 
 private:
     static constexpr float MOVEMENT_SPEED = 0.07f;
 
     Vector2 position;
+    Vector2 previousPosition;
     bool lookingRight;
 };
 
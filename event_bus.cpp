@@ -0,0 +1,71 @@
+#include "event_bus.h"
+#include <chrono>
+
+EventBus::EventBus() : running(false) {}
+
+EventBus::~EventBus() {
+    stop();
+    for (Consumer* consumer : consumers) {
+        delete consumer;
+    }
+}
+
+void EventBus::subscribe(const char* name, EventHandler onEvent, BatchHandler onBatchEnd) {
+    Consumer* consumer = new Consumer();
+    consumer->name = name;
+    consumer->onEvent = std::move(onEvent);
+    consumer->onBatchEnd = std::move(onBatchEnd);
+    consumer->dropped = 0;
+    consumers.push_back(consumer);
+}
+
+void EventBus::start() {
+    if (running.exchange(true)) return;
+    for (Consumer* consumer : consumers) {
+        consumer->thread = std::thread(&EventBus::consume, this, std::ref(*consumer));
+    }
+}
+
+void EventBus::stop() {
+    if (!running.exchange(false)) return;
+    for (Consumer* consumer : consumers) {
+        consumer->thread.join();
+    }
+}
+
+void EventBus::publish(const GameEvent& event) {
+    for (Consumer* consumer : consumers) {
+        if (!consumer->queue.push(event)) consumer->dropped++;
+    }
+}
+
+void EventBus::publish(const std::vector<GameEvent>& events) {
+    for (const GameEvent& event : events) {
+        publish(event);
+    }
+}
+
+size_t EventBus::getMemoryUsage() const {
+    return consumers.capacity() * sizeof(Consumer*) + consumers.size() * sizeof(Consumer);
+}
+
+void EventBus::consume(Consumer& consumer) {
+    for (;;) {
+        // Read before draining, so everything published before stop() is
+        // still delivered.
+        bool stopping = !running.load(std::memory_order_acquire);
+        GameEvent event;
+        size_t drained = 0;
+        while (consumer.queue.pop(event)) {
+            consumer.onEvent(event);
+            drained++;
+        }
+        if (drained > 0) {
+            if (consumer.onBatchEnd) consumer.onBatchEnd();
+        } else if (stopping) {
+            break;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_SLEEP_MS));
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include "game_event.h"
+#include "spsc_queue.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Hands each tick's GameEvents from the game loop to consumers running on
+// their own threads, such as audio and telemetry. Every consumer gets its own
+// SpscQueue, so publishing is a few stores per consumer, never takes a lock
+// and never waits on a consumer; if a consumer falls a whole queue behind,
+// its newest events are dropped and counted.
+//
+// Consumers poll their queue and sleep IDLE_SLEEP_MS while it is empty.
+// Subscribe everything before start(); handlers run on the consumer's thread
+// only.
+class EventBus {
+public:
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+    static constexpr int IDLE_SLEEP_MS = 1;
+
+    using EventHandler = std::function<void(const GameEvent&)>;
+    // Called after each drained batch, e.g. to act on the last tick's events.
+    using BatchHandler = std::function<void()>;
+
+    EventBus();
+    ~EventBus();
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    void subscribe(const char* name, EventHandler onEvent, BatchHandler onBatchEnd = nullptr);
+    void start();
+    // Drains whatever is queued, then joins the consumer threads.
+    void stop();
+
+    void publish(const GameEvent& event);
+    void publish(const std::vector<GameEvent>& events);
+
+    size_t getConsumerCount() const { return consumers.size(); }
+    const char* getConsumerName(size_t index) const { return consumers[index]->name; }
+    uint64_t getDroppedCount(size_t index) const { return consumers[index]->dropped; }
+    size_t getMemoryUsage() const;
+
+private:
+    struct Consumer {
+        const char* name;
+        EventHandler onEvent;
+        BatchHandler onBatchEnd;
+        SpscQueue<GameEvent, QUEUE_CAPACITY> queue;
+        // Written by the publishing thread only.
+        uint64_t dropped;
+        std::thread thread;
+    };
+
+    void consume(Consumer& consumer);
+
+    std::vector<Consumer*> consumers;
+    std::atomic<bool> running;
+};
+
+#endif // EVENT_BUS_H
@@ -0,0 +1,71 @@
+#include "font_atlas.h"
+#include "asset_archive.h"
+#include <algorithm>
+
+FontAtlas::FontAtlas(const std::string& path) : path(path) {}
+
+FontAtlas::~FontAtlas() {
+    unload();
+}
+
+int FontAtlas::bucketFor(float designSize) {
+    // Design sizes are authored for a 700px screen; the default window is
+    // about half of that, so bake at half the design size and let larger
+    // windows upscale the pixel font.
+    int bucket = MIN_BUCKET_SIZE;
+    while (bucket * 2 <= designSize * 0.5f && bucket * 2 <= MAX_BUCKET_SIZE) {
+        bucket *= 2;
+    }
+    return bucket;
+}
+
+void FontAtlas::addSize(float designSize) {
+    int bucket = bucketFor(designSize);
+    if (std::find(sizes.begin(), sizes.end(), bucket) == sizes.end()) {
+        sizes.push_back(bucket);
+        std::sort(sizes.begin(), sizes.end());
+    }
+}
+
+void FontAtlas::load(const AssetArchive* assets) {
+    unload();
+    if (sizes.empty()) {
+        sizes.push_back(MIN_BUCKET_SIZE);
+    }
+
+    for (int size : sizes) {
+        Font font = assets->loadFont(path, size, GLYPH_COUNT);
+        SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);
+        buckets.push_back({size, font});
+    }
+
+    TraceLog(LOG_INFO, "FONT: %s baked into %zu bucket(s), %zu bytes of atlas memory",
+             path.c_str(), buckets.size(), getMemoryUsage());
+}
+
+void FontAtlas::unload() {
+    for (auto& bucket : buckets) {
+        UnloadFont(bucket.font);
+    }
+    buckets.clear();
+}
+
+const Font& FontAtlas::pick(float pixelSize) const {
+    const Bucket* best = &buckets.front();
+    for (const auto& bucket : buckets) {
+        if (static_cast<float>(bucket.size) <= pixelSize) {
+            best = &bucket;
+        }
+    }
+    return best->font;
+}
+
+size_t FontAtlas::getMemoryUsage() const {
+    size_t total = 0;
+    for (const auto& bucket : buckets) {
+        const Texture2D& texture = bucket.font.texture;
+        total += static_cast<size_t>(GetPixelDataSize(texture.width, texture.height, texture.format));
+        total += static_cast<size_t>(bucket.font.glyphCount) * (sizeof(GlyphInfo) + sizeof(Rectangle));
+    }
+    return total;
+}
\ No newline at end of file
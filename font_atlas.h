@@ -0,0 +1,45 @@
+#ifndef FONT_ATLAS_H
+#define FONT_ATLAS_H
+
+#include "raylib.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+
+class AssetArchive;
+
+// A font baked into a few small size buckets instead of one huge atlas.
+// ARCADE_N is drawn on an 8px grid, so a bucket that is a power-of-two
+// multiple of 8 upscales without blur under point filtering; each text is
+// drawn from the largest bucket not bigger than its on-screen size.
+class FontAtlas {
+public:
+    static constexpr int GLYPH_COUNT = 95;
+    static constexpr int MIN_BUCKET_SIZE = 8;
+    static constexpr int MAX_BUCKET_SIZE = 64;
+
+    explicit FontAtlas(const std::string& path);
+    ~FontAtlas();
+
+    void addSize(float designSize);
+    void load(const AssetArchive* assets);
+    void unload();
+
+    const Font& pick(float pixelSize) const;
+    size_t getBucketCount() const { return buckets.size(); }
+    size_t getMemoryUsage() const;
+
+    static int bucketFor(float designSize);
+
+private:
+    struct Bucket {
+        int size;
+        Font font;
+    };
+
+    std::string path;
+    std::vector<int> sizes;
+    std::vector<Bucket> buckets;
+};
+
+#endif // FONT_ATLAS_H
\ No newline at end of file
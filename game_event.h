@@ -0,0 +1,28 @@
+#ifndef GAME_EVENT_H
+#define GAME_EVENT_H
+
+#include "raylib.h"
+#include <cstddef>
+
+// Side effects of a simulation tick, reported to the frontend instead of
+// being played or logged inline.
+struct GameEvent {
+    enum Type {
+        COIN_COLLECTED,
+        ENEMY_KILLED,
+        PLAYER_DIED,
+        EXIT_TOUCHED,
+        STATE_CHANGED,
+        QUIT_REQUESTED,
+        // Simulation::restoreState() jumped to another tick (quick load, rewind).
+        STATE_RESTORED
+    };
+
+    Type type;
+    size_t frame;
+    Vector2 position;
+    int previousState;  // Simulation::GameState, STATE_CHANGED only
+    int state;
+};
+
+#endif // GAME_EVENT_H
\ No newline at end of file
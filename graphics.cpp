@@ -2,73 +2,113 @@
 #include "level.h"
 #include "player.h"
 #include "enemy.h"
-#include <cstdlib>
+#include "asset_archive.h"
+#include "font_atlas.h"
+#include "options.h"
+#include "profiler.h"
+#include "visible_tiles.h"
+#include "arena.h"
+#include "trace.h"
+#include "memory_report.h"
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 
 const Color Graphics::VICTORY_BALL_COLOR = {180, 180, 180, 255};
 
-Graphics::Graphics(Player* player) : player(player), screenScale(1.0f), cellSize(0), horizontalShift(0) {
-    screenSize = {static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight())};
-
-    menuFont = LoadFontEx("data/fonts/ARCADE_N.TTF", 256, nullptr, 128);
-    gameTitle = {"Platformer", {0.50f, 0.50f}, 100.0f, RED, 4.0f, &menuFont};
-    gameSubtitle = {"Press Enter to Start", {0.50f, 0.65f}, 32.0f, WHITE, 4.0f, &menuFont};
-    gamePaused = {"Press Escape to Resume", {0.50f, 0.50f}, 32.0f, WHITE, 4.0f, &menuFont};
-    deathTitle = {"You Died!", {0.50f, 0.50f}, 80.0f, RED, 4.0f, &menuFont};
-    deathSubtitle = {"Press Enter to Try Again", {0.50f, 0.65f}, 32.0f, WHITE, 4.0f, &menuFont};
-    gameOverTitle = {"Game Over", {0.50f, 0.50f}, 120.0f, RED, 4.0f, &menuFont};
-    gameOverSubtitle = {"Press Enter to Restart", {0.50f, 0.675f}, 32.0f, WHITE, 4.0f, &menuFont};
-    victoryTitle = {"You Won!", {0.50f, 0.50f}, 100.0f, RED, 4.0f, &menuFont};
-    victorySubtitle = {"Press Enter to go back to menu", {0.50f, 0.65f}, 32.0f, WHITE, 4.0f, &menuFont};
+Graphics::Graphics(Player* player, const AssetArchive* assets, const GameOptions& options, uint64_t seed) :
+    victoryBallFrame(SIZE_MAX),
+    player(player),
+    assets(assets),
+    screenScale(1.0f),
+    cellSize(0),
+    horizontalShift(0),
+    useRenderTarget(options.renderWidth > 0 && options.renderHeight > 0),
+    renderTarget(),
+    internalSize{static_cast<float>(options.renderWidth), static_cast<float>(options.renderHeight)},
+    integerScaling(options.integerScaling),
+    dynamicResolution(options.dynamicResolution),
+    resolutionScale(1.0f),
+    frameBudget(options.frameBudgetMs / 1000.0f),
+    averageFrameTime(options.frameBudgetMs / 1000.0f),
+    framesWithinBudget(0),
+    random(Random::derive(seed, Random::GRAPHICS_STREAM)) {
+    if (useRenderTarget) {
+        resizeRenderTarget(options.renderWidth, options.renderHeight);
+    }
+    updateScreenMetrics();
+
+    menuFont = new FontAtlas("data/fonts/ARCADE_N.TTF");
+    gameTitle = {"Platformer", {0.50f, 0.50f}, 100.0f, RED, 4.0f, menuFont};
+    gameSubtitle = {"Press Enter to Start", {0.50f, 0.65f}, 32.0f, WHITE, 4.0f, menuFont};
+    gamePaused = {"Press Escape to Resume", {0.50f, 0.50f}, 32.0f, WHITE, 4.0f, menuFont};
+    deathTitle = {"You Died!", {0.50f, 0.50f}, 80.0f, RED, 4.0f, menuFont};
+    deathSubtitle = {"Press Enter to Try Again", {0.50f, 0.65f}, 32.0f, WHITE, 4.0f, menuFont};
+    gameOverTitle = {"Game Over", {0.50f, 0.50f}, 120.0f, RED, 4.0f, menuFont};
+    gameOverSubtitle = {"Press Enter to Restart", {0.50f, 0.675f}, 32.0f, WHITE, 4.0f, menuFont};
+    victoryTitle = {"You Won!", {0.50f, 0.50f}, 100.0f, RED, 4.0f, menuFont};
+    victorySubtitle = {"Press Enter to go back to menu", {0.50f, 0.65f}, 32.0f, WHITE, 4.0f, menuFont};
+
+    for (const Text* text : {&gameTitle, &gameSubtitle, &gamePaused, &deathTitle, &deathSubtitle,
+                             &gameOverTitle, &gameOverSubtitle, &victoryTitle, &victorySubtitle}) {
+        menuFont->addSize(text->size);
+    }
+    menuFont->addSize(HUD_ICON_SIZE);
 
     loadAssets();
 }
 
 Graphics::~Graphics() {
     unloadAssets();
+    delete menuFont;
+    if (useRenderTarget) {
+        UnloadRenderTexture(renderTarget);
+    }
 }
 
 void Graphics::loadAssets() {
-    wallImage = LoadTexture("data/images/wall.png");
-    wallDarkImage = LoadTexture("data/images/wall_dark.png");
-    spikeImage = LoadTexture("data/images/spikes.png");
-    exitImage = LoadTexture("data/images/exit.png");
+    TRACE_SCOPE("load graphics", "assets");
+    menuFont->load(assets);
+
+    wallImage = assets->loadTexture("data/images/wall.png");
+    wallDarkImage = assets->loadTexture("data/images/wall_dark.png");
+    spikeImage = assets->loadTexture("data/images/spikes.png");
+    exitImage = assets->loadTexture("data/images/exit.png");
 
     coinSprite = Sprite{3, 18, 0, 0, true, 0, new Texture2D[3]};
-    coinSprite.frames[0] = LoadTexture("data/images/coin/coin0.png");
-    coinSprite.frames[1] = LoadTexture("data/images/coin/coin1.png");
-    coinSprite.frames[2] = LoadTexture("data/images/coin/coin2.png");
+    coinSprite.frames[0] = assets->loadTexture("data/images/coin/coin0.png");
+    coinSprite.frames[1] = assets->loadTexture("data/images/coin/coin1.png");
+    coinSprite.frames[2] = assets->loadTexture("data/images/coin/coin2.png");
 
-    heartImage = LoadTexture("data/images/heart.png");
+    heartImage = assets->loadTexture("data/images/heart.png");
 
-    playerStandForwardImage = LoadTexture("data/images/player_stand_forward.png");
-    playerStandBackwardsImage = LoadTexture("data/images/player_stand_backwards.png");
-    playerJumpForwardImage = LoadTexture("data/images/player_jump_forward.png");
-    playerJumpBackwardsImage = LoadTexture("data/images/player_jump_backwards.png");
-    playerDeadImage = LoadTexture("data/images/player_dead.png");
+    playerStandForwardImage = assets->loadTexture("data/images/player_stand_forward.png");
+    playerStandBackwardsImage = assets->loadTexture("data/images/player_stand_backwards.png");
+    playerJumpForwardImage = assets->loadTexture("data/images/player_jump_forward.png");
+    playerJumpBackwardsImage = assets->loadTexture("data/images/player_jump_backwards.png");
+    playerDeadImage = assets->loadTexture("data/images/player_dead.png");
 
     playerWalkForwardSprite = Sprite{3, 15, 0, 0, true, 0, new Texture2D[3]};
-    playerWalkForwardSprite.frames[0] = LoadTexture("data/images/player_walk_forward/player0.png");
-    playerWalkForwardSprite.frames[1] = LoadTexture("data/images/player_walk_forward/player1.png");
-    playerWalkForwardSprite.frames[2] = LoadTexture("data/images/player_walk_forward/player2.png");
+    playerWalkForwardSprite.frames[0] = assets->loadTexture("data/images/player_walk_forward/player0.png");
+    playerWalkForwardSprite.frames[1] = assets->loadTexture("data/images/player_walk_forward/player1.png");
+    playerWalkForwardSprite.frames[2] = assets->loadTexture("data/images/player_walk_forward/player2.png");
 
     playerWalkBackwardsSprite = Sprite{3, 15, 0, 0, true, 0, new Texture2D[3]};
-    playerWalkBackwardsSprite.frames[0] = LoadTexture("data/images/player_walk_backwards/player0.png");
-    playerWalkBackwardsSprite.frames[1] = LoadTexture("data/images/player_walk_backwards/player1.png");
-    playerWalkBackwardsSprite.frames[2] = LoadTexture("data/images/player_walk_backwards/player2.png");
+    playerWalkBackwardsSprite.frames[0] = assets->loadTexture("data/images/player_walk_backwards/player0.png");
+    playerWalkBackwardsSprite.frames[1] = assets->loadTexture("data/images/player_walk_backwards/player1.png");
+    playerWalkBackwardsSprite.frames[2] = assets->loadTexture("data/images/player_walk_backwards/player2.png");
 
     enemyWalkSprite = Sprite{2, 15, 0, 0, true, 0, new Texture2D[2]};
-    enemyWalkSprite.frames[0] = LoadTexture("data/images/enemy_walk/enemy0.png");
-    enemyWalkSprite.frames[1] = LoadTexture("data/images/enemy_walk/enemy1.png");
+    enemyWalkSprite.frames[0] = assets->loadTexture("data/images/enemy_walk/enemy0.png");
+    enemyWalkSprite.frames[1] = assets->loadTexture("data/images/enemy_walk/enemy1.png");
 
-    backgroundImage = LoadTexture("data/images/background/background.png");
-    middlegroundImage = LoadTexture("data/images/background/middleground.png");
-    foregroundImage = LoadTexture("data/images/background/foreground.png");
+    backgroundImage = assets->loadTexture("data/images/background/background.png");
+    middlegroundImage = assets->loadTexture("data/images/background/middleground.png");
+    foregroundImage = assets->loadTexture("data/images/background/foreground.png");
 }
 
 void Graphics::unloadAssets() {
-    UnloadFont(menuFont);
+    menuFont->unload();
     UnloadTexture(wallImage);
     UnloadTexture(wallDarkImage);
     UnloadTexture(spikeImage);
@@ -107,12 +147,13 @@ void Graphics::unloadAssets() {
 }
 
 void Graphics::drawText(const Text& text) {
-    Vector2 dimensions = MeasureTextEx(*text.font, text.str.c_str(), text.size * screenScale, text.spacing);
+    const Font& font = text.font->pick(text.size * screenScale);
+    Vector2 dimensions = MeasureTextEx(font, text.str.c_str(), text.size * screenScale, text.spacing);
     Vector2 pos = {
         (screenSize.x * text.position.x) - (0.5f * dimensions.x),
         (screenSize.y * text.position.y) - (0.5f * dimensions.y)
     };
-    DrawTextEx(*text.font, text.str.c_str(), pos, dimensions.y, text.spacing, text.color);
+    DrawTextEx(font, text.str.c_str(), pos, dimensions.y, text.spacing, text.color);
 }
 
 void Graphics::drawSprite(Sprite& sprite, Vector2 pos, float size, size_t gameFrame) {
@@ -136,11 +177,99 @@ void Graphics::drawImage(Texture2D image, Vector2 pos, float size) {
     DrawTexturePro(image, source, destination, {0.0f, 0.0f}, 0.0f, WHITE);
 }
 
+void Graphics::resizeRenderTarget(int width, int height) {
+    if (renderTarget.id != 0) {
+        UnloadRenderTexture(renderTarget);
+    }
+    renderTarget = LoadRenderTexture(width, height);
+    SetTextureFilter(renderTarget.texture, TEXTURE_FILTER_POINT);
+}
+
+void Graphics::beginFrame() {
+    if (useRenderTarget) {
+        int width = std::max(1, static_cast<int>(internalSize.x * resolutionScale));
+        int height = std::max(1, static_cast<int>(internalSize.y * resolutionScale));
+        if (renderTarget.texture.width != width || renderTarget.texture.height != height) {
+            resizeRenderTarget(width, height);
+        }
+        BeginTextureMode(renderTarget);
+    } else {
+        BeginDrawing();
+    }
+    updateScreenMetrics();
+}
+
+void Graphics::endFrame() {
+    if (!useRenderTarget) {
+        PROFILE_SCOPE(PRESENT);
+        EndDrawing();
+        return;
+    }
+
+    EndTextureMode();
+
+    float windowWidth = static_cast<float>(GetScreenWidth());
+    float windowHeight = static_cast<float>(GetScreenHeight());
+    float scale = std::min(windowWidth / internalSize.x, windowHeight / internalSize.y);
+    if (integerScaling && scale >= 1.0f) {
+        scale = std::floor(scale);
+    }
+    Vector2 presentedSize = {internalSize.x * scale, internalSize.y * scale};
+
+    // Render textures are stored bottom-up, hence the negative source height.
+    Rectangle source = {0.0f, 0.0f, static_cast<float>(renderTarget.texture.width), -static_cast<float>(renderTarget.texture.height)};
+    Rectangle destination = {
+        std::floor((windowWidth - presentedSize.x) * 0.5f),
+        std::floor((windowHeight - presentedSize.y) * 0.5f),
+        presentedSize.x,
+        presentedSize.y
+    };
+
+    BeginDrawing();
+    ClearBackground(BLACK);
+    DrawTexturePro(renderTarget.texture, source, destination, {0.0f, 0.0f}, 0.0f, WHITE);
+    {
+        PROFILE_SCOPE(PRESENT);
+        EndDrawing();
+    }
+
+    if (dynamicResolution) {
+        updateDynamicResolution();
+    }
+}
+
+void Graphics::updateDynamicResolution() {
+    averageFrameTime += (GetFrameTime() - averageFrameTime) * FRAME_TIME_SMOOTHING;
+
+    if (averageFrameTime > frameBudget * OVER_BUDGET_FACTOR && resolutionScale > MIN_RESOLUTION_SCALE) {
+        resolutionScale = std::max(MIN_RESOLUTION_SCALE, resolutionScale - RESOLUTION_SCALE_STEP);
+        averageFrameTime = frameBudget;
+        framesWithinBudget = 0;
+        TraceLog(LOG_INFO, "Dynamic resolution: scaling render target down to %.0f%%", resolutionScale * 100.0f);
+    } else if (averageFrameTime <= frameBudget * WITHIN_BUDGET_FACTOR && resolutionScale < 1.0f) {
+        if (++framesWithinBudget >= FRAMES_BEFORE_UPSCALE) {
+            resolutionScale = std::min(1.0f, resolutionScale + RESOLUTION_SCALE_STEP);
+            framesWithinBudget = 0;
+            TraceLog(LOG_INFO, "Dynamic resolution: scaling render target up to %.0f%%", resolutionScale * 100.0f);
+        }
+    } else {
+        framesWithinBudget = 0;
+    }
+}
+
+void Graphics::updateScreenMetrics() {
+    if (useRenderTarget) {
+        screenSize.x = static_cast<float>(renderTarget.texture.width);
+        screenSize.y = static_cast<float>(renderTarget.texture.height);
+    } else {
+        screenSize.x = static_cast<float>(GetScreenWidth());
+        screenSize.y = static_cast<float>(GetScreenHeight());
+    }
+    screenScale = std::min(screenSize.x, screenSize.y) / SCREEN_SCALE_DIVISOR;
+}
+
 void Graphics::deriveMetricsFromLevel(Level* level) {
-    screenSize.x = static_cast<float>(GetScreenWidth());
-    screenSize.y = static_cast<float>(GetScreenHeight());
     cellSize = screenSize.y / static_cast<float>(level->getRows());
-    screenScale = std::min(screenSize.x, screenSize.y) / SCREEN_SCALE_DIVISOR;
 
     float largerScreenSide = std::max(screenSize.x, screenSize.y);
     if (screenSize.x > screenSize.y) {
@@ -151,8 +280,13 @@ void Graphics::deriveMetricsFromLevel(Level* level) {
     backgroundYOffset = (screenSize.y - backgroundSize.y) * 0.5f;
 }
 
-void Graphics::drawParallaxBackground(size_t gameFrame) {
-    float initialOffset = -(player->getPosition().x * PARALLAX_PLAYER_SCROLLING_SPEED + gameFrame * PARALLAX_IDLE_SCROLLING_SPEED);
+Vector2 Graphics::interpolate(Vector2 from, Vector2 to, float alpha) {
+    return {from.x + (to.x - from.x) * alpha, from.y + (to.y - from.y) * alpha};
+}
+
+void Graphics::drawParallaxBackground(size_t gameFrame, float cameraX) {
+    PROFILE_SCOPE(BACKGROUND);
+    float initialOffset = -(cameraX * PARALLAX_PLAYER_SCROLLING_SPEED + gameFrame * PARALLAX_IDLE_SCROLLING_SPEED);
     float backgroundOffset = initialOffset;
     float middlegroundOffset = backgroundOffset * PARALLAX_LAYERED_SPEED_DIFFERENCE;
     float foregroundOffset = middlegroundOffset * PARALLAX_LAYERED_SPEED_DIFFERENCE;
@@ -188,44 +322,40 @@ void Graphics::drawMenu() {
     drawText(gameSubtitle);
 }
 
-void Graphics::drawGame(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame) {
+void Graphics::drawGame(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame, float alpha) {
+    // Positions are blended between the last two simulation ticks.
+    Vector2 playerPosition = interpolate(player->getPreviousPosition(), player->getPosition(), alpha);
+
     ClearBackground(BLACK);
     deriveMetricsFromLevel(level);
-    drawParallaxBackground(gameFrame);
+    drawParallaxBackground(gameFrame, playerPosition.x);
 
     horizontalShift = (screenSize.x - cellSize) / 2;
 
-    for (size_t row = 0; row < level->getRows(); ++row) {
-        for (size_t column = 0; column < level->getColumns(); ++column) {
-            Vector2 pos = {
-                (static_cast<float>(column) - player->getPosition().x) * cellSize + horizontalShift,
-                static_cast<float>(row) * cellSize
-            };
-
-            char cell = level->getCell(row, column);
-            if (cell == level->getWallChar()) {
-                drawImage(wallImage, pos, cellSize);
-            } else if (cell == level->getWallDarkChar()) {
-                drawImage(wallDarkImage, pos, cellSize);
-            } else if (cell == level->getSpikeChar()) {
-                drawImage(spikeImage, pos, cellSize);
-            } else if (cell == level->getCoinChar()) {
-                drawSprite(coinSprite, pos, cellSize, gameFrame);
-            } else if (cell == level->getExitChar()) {
-                drawImage(exitImage, pos, cellSize);
+    {
+        PROFILE_SCOPE(TILES);
+        collectVisibleTiles(*level, playerPosition.x, cellSize, horizontalShift, screenSize.x, visibleTiles);
+        for (const VisibleTile& visible : visibleTiles) {
+            switch (visible.tile) {
+                case WALL: drawImage(wallImage, visible.position, cellSize); break;
+                case WALL_DARK: drawImage(wallDarkImage, visible.position, cellSize); break;
+                case SPIKE: drawImage(spikeImage, visible.position, cellSize); break;
+                case COIN: drawSprite(coinSprite, visible.position, cellSize, gameFrame); break;
+                case EXIT: drawImage(exitImage, visible.position, cellSize); break;
             }
         }
     }
 
     for (const auto& enemy : enemies) {
+        Vector2 enemyPosition = interpolate(enemy->getPreviousPosition(), enemy->getPosition(), alpha);
         Vector2 pos = {
-            (enemy->getPosition().x - player->getPosition().x) * cellSize + horizontalShift,
-            enemy->getPosition().y * cellSize
+            (enemyPosition.x - playerPosition.x) * cellSize + horizontalShift,
+            enemyPosition.y * cellSize
         };
         drawSprite(enemyWalkSprite, pos, cellSize, gameFrame);
     }
 
-    Vector2 playerPos = {horizontalShift, player->getPosition().y * cellSize};
+    Vector2 playerPos = {horizontalShift, playerPosition.y * cellSize};
     if (!player->isDead()) {
         if (!player->isOnGround()) {
             drawImage(player->isLookingForward() ? playerJumpForwardImage : playerJumpBackwardsImage, playerPos, cellSize);
@@ -238,7 +368,9 @@ void Graphics::drawGame(Level* level, const std::vector<Enemy*>& enemies, size_t
         drawImage(playerDeadImage, playerPos, cellSize);
     }
 
-    const float ICON_SIZE = 48.0f * screenScale;
+    PROFILE_SCOPE(HUD);
+    const float ICON_SIZE = HUD_ICON_SIZE * screenScale;
+    const Font& hudFont = menuFont->pick(ICON_SIZE);
     float verticalOffset = 8.0f * screenScale;
 
     for (int i = 0; i < player->getLives(); i++) {
@@ -246,19 +378,24 @@ void Graphics::drawGame(Level* level, const std::vector<Enemy*>& enemies, size_t
         drawImage(heartImage, heartPos, ICON_SIZE);
     }
 
-    Vector2 timerDimensions = MeasureTextEx(menuFont, std::to_string(player->getTimer() / 60).c_str(), ICON_SIZE, 2.0f);
-    Vector2 timerPosition = {(GetRenderWidth() - timerDimensions.x) * 0.5f, verticalOffset};
-    DrawTextEx(menuFont, std::to_string(player->getTimer() / 60).c_str(), timerPosition, ICON_SIZE, 2.0f, WHITE);
-
-    Vector2 scoreDimensions = MeasureTextEx(menuFont, std::to_string(player->getTotalScore()).c_str(), ICON_SIZE, 2.0f);
-    Vector2 scorePosition = {GetRenderWidth() - scoreDimensions.x - ICON_SIZE, verticalOffset};
-    DrawTextEx(menuFont, std::to_string(player->getTotalScore()).c_str(), scorePosition, ICON_SIZE, 2.0f, WHITE);
-    drawSprite(coinSprite, {GetRenderWidth() - ICON_SIZE, verticalOffset}, ICON_SIZE, gameFrame);
+    // Formatted into the frame arena: the HUD is drawn every gameplay frame,
+    // which must not touch the heap (see --zero-alloc).
+    Arena& frameArena = Arena::frame();
+    const char* timer = frameArena.format("%d", player->getTimer() / 60);
+    Vector2 timerDimensions = MeasureTextEx(hudFont, timer, ICON_SIZE, 2.0f);
+    Vector2 timerPosition = {(screenSize.x - timerDimensions.x) * 0.5f, verticalOffset};
+    DrawTextEx(hudFont, timer, timerPosition, ICON_SIZE, 2.0f, WHITE);
+
+    const char* score = frameArena.format("%d", player->getTotalScore());
+    Vector2 scoreDimensions = MeasureTextEx(hudFont, score, ICON_SIZE, 2.0f);
+    Vector2 scorePosition = {screenSize.x - scoreDimensions.x - ICON_SIZE, verticalOffset};
+    DrawTextEx(hudFont, score, scorePosition, ICON_SIZE, 2.0f, WHITE);
+    drawSprite(coinSprite, {screenSize.x - ICON_SIZE, verticalOffset}, ICON_SIZE, gameFrame);
 }
 
-void Graphics::drawDeathScreen(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame) {
-    drawGame(level, enemies, gameFrame);
-    DrawRectangle(0, 0, GetRenderWidth(), GetRenderHeight(), {0, 0, 0, 100});
+void Graphics::drawDeathScreen(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame, float alpha) {
+    drawGame(level, enemies, gameFrame, alpha);
+    DrawRectangle(0, 0, static_cast<int>(screenSize.x), static_cast<int>(screenSize.y), {0, 0, 0, 100});
     drawText(deathTitle);
     drawText(deathSubtitle);
 }
@@ -277,14 +414,22 @@ void Graphics::drawPauseMenu() {
 void Graphics::drawVictoryMenu(size_t gameFrame) {
     DrawRectangle(0, 0, static_cast<int>(screenSize.x), static_cast<int>(screenSize.y), {0, 0, 0, VICTORY_BALL_TRAIL_TRANSPARENCY});
 
+    // The balls move by dx/dy once per simulation tick, not per rendered
+    // frame, so their speed does not depend on the display refresh rate.
+    if (victoryBallFrame == SIZE_MAX || gameFrame < victoryBallFrame) victoryBallFrame = gameFrame;
+    size_t steps = std::min(gameFrame - victoryBallFrame, VICTORY_BALL_MAX_STEPS);
+    victoryBallFrame = gameFrame;
+
     for (auto& ball : victoryBalls) {
-        ball.x += ball.dx;
-        if (ball.x - ball.radius < 0 || ball.x + ball.radius >= screenSize.x) {
-            ball.dx = -ball.dx;
-        }
-        ball.y += ball.dy;
-        if (ball.y - ball.radius < 0 || ball.y + ball.radius >= screenSize.y) {
-            ball.dy = -ball.dy;
+        for (size_t step = 0; step < steps; step++) {
+            ball.x += ball.dx;
+            if (ball.x - ball.radius < 0 || ball.x + ball.radius >= screenSize.x) {
+                ball.dx = -ball.dx;
+            }
+            ball.y += ball.dy;
+            if (ball.y - ball.radius < 0 || ball.y + ball.radius >= screenSize.y) {
+                ball.dy = -ball.dy;
+            }
         }
         DrawCircleV({ball.x, ball.y}, ball.radius, VICTORY_BALL_COLOR);
     }
@@ -294,14 +439,160 @@ void Graphics::drawVictoryMenu(size_t gameFrame) {
 }
 
 void Graphics::initializeVictoryBalls() {
-    deriveMetricsFromLevel(nullptr);
+    updateScreenMetrics();
+    victoryBallFrame = SIZE_MAX;
     for (auto& ball : victoryBalls) {
-        ball.x = static_cast<float>(rand()) / RAND_MAX * screenSize.x;
-        ball.y = static_cast<float>(rand()) / RAND_MAX * screenSize.y;
-        ball.dx = (static_cast<float>(rand()) / RAND_MAX * 2 - 1) * VICTORY_BALL_MAX_SPEED * screenScale;
-        if (abs(ball.dx) < 0.1f) ball.dx = 1.0f;
-        ball.dy = (static_cast<float>(rand()) / RAND_MAX * 2 - 1) * VICTORY_BALL_MAX_SPEED * screenScale;
-        if (abs(ball.dy) < 0.1f) ball.dy = 1.0f;
-        ball.radius = (static_cast<float>(rand()) / RAND_MAX * (VICTORY_BALL_MAX_RADIUS - VICTORY_BALL_MIN_RADIUS) + VICTORY_BALL_MIN_RADIUS) * screenScale;
+        ball.x = random.nextFloat(0.0f, screenSize.x);
+        ball.y = random.nextFloat(0.0f, screenSize.y);
+        ball.dx = random.nextFloat(-1.0f, 1.0f) * VICTORY_BALL_MAX_SPEED * screenScale;
+        if (std::abs(ball.dx) < 0.1f) ball.dx = 1.0f;
+        ball.dy = random.nextFloat(-1.0f, 1.0f) * VICTORY_BALL_MAX_SPEED * screenScale;
+        if (std::abs(ball.dy) < 0.1f) ball.dy = 1.0f;
+        ball.radius = random.nextFloat(VICTORY_BALL_MIN_RADIUS, VICTORY_BALL_MAX_RADIUS) * screenScale;
+    }
+}
+void Graphics::drawProfilerOverlay(const Profiler& profiler) {
+    const int fontSize = std::max(10, static_cast<int>(14.0f * screenScale));
+    const int lineHeight = fontSize + 2;
+    const int graphHeight = 4 * lineHeight;
+    const int left = 8;
+    const int top = static_cast<int>(HUD_ICON_SIZE * screenScale) + 16;
+    const int columnWidth = 5 * fontSize;
+    const int width = 5 * columnWidth + 2 * fontSize;
+
+    size_t frames = profiler.copyHistory(profileHistory);
+    int height = (Profiler::PHASE_COUNT + 1) * lineHeight + graphHeight + 12;
+    DrawRectangle(left - 4, top - 4, width, height, {0, 0, 0, 180});
+
+    int y = top;
+    DrawText("phase", left, y, fontSize, GRAY);
+    DrawText("p50 ms", left + columnWidth, y, fontSize, GRAY);
+    DrawText("p99 ms", left + 2 * columnWidth, y, fontSize, GRAY);
+    DrawText("max ms", left + 3 * columnWidth, y, fontSize, GRAY);
+    DrawText("allocs/f", left + 4 * columnWidth, y, fontSize, GRAY);
+    uint64_t endedFrames = std::max<uint64_t>(profiler.getFrameCount(), 1);
+    for (int phase = 0; phase < Profiler::PHASE_COUNT; phase++) {
+        y += lineHeight;
+        Profiler::Stats stats = profiler.getStats(profileHistory, static_cast<Profiler::Phase>(phase));
+        Color color = phase == Profiler::FRAME ? YELLOW : WHITE;
+        DrawText(Profiler::getPhaseName(static_cast<Profiler::Phase>(phase)), left, y, fontSize, color);
+        DrawText(TextFormat("%.2f", stats.p50Ms), left + columnWidth, y, fontSize, color);
+        DrawText(TextFormat("%.2f", stats.p99Ms), left + 2 * columnWidth, y, fontSize, color);
+        DrawText(TextFormat("%.2f", stats.maxMs), left + 3 * columnWidth, y, fontSize, color);
+        const Profiler::Allocations& allocations = profiler.getTotalAllocations(static_cast<Profiler::Phase>(phase));
+        DrawText(TextFormat("%.2f", static_cast<double>(allocations.count) / endedFrames), left + 4 * columnWidth, y,
+                 fontSize, allocations.count > 0 ? ORANGE : color);
+    }
+
+    // Frame times, newest on the right, scaled so the budget line sits at half height.
+    int graphBottom = y + lineHeight + 4 + graphHeight;
+    int graphWidth = width - 8;
+    float pixelsPerSecond = graphHeight * 0.5f / frameBudget;
+    size_t shown = std::min(frames, static_cast<size_t>(graphWidth));
+    for (size_t i = 0; i < shown; i++) {
+        uint32_t nanoseconds = profileHistory[(frames - shown + i) * Profiler::PHASE_COUNT + Profiler::FRAME];
+        float seconds = nanoseconds / 1e9f;
+        int bar = std::min(graphHeight, static_cast<int>(seconds * pixelsPerSecond));
+        Color color = seconds > frameBudget ? RED : GREEN;
+        DrawLine(left + graphWidth - static_cast<int>(shown) + static_cast<int>(i), graphBottom,
+                 left + graphWidth - static_cast<int>(shown) + static_cast<int>(i), graphBottom - bar, color);
     }
-}
\ No newline at end of file
+    DrawLine(left, graphBottom - graphHeight / 2, left + graphWidth, graphBottom - graphHeight / 2, YELLOW);
+}
+
+size_t Graphics::textureBytes(const Texture2D& texture) {
+    size_t bytes = 0;
+    int width = texture.width;
+    int height = texture.height;
+    for (int level = 0; level < std::max(texture.mipmaps, 1); level++) {
+        bytes += static_cast<size_t>(GetPixelDataSize(width, height, texture.format));
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return bytes;
+}
+
+size_t Graphics::spriteBytes(const Sprite& sprite) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < sprite.frameCount; i++) bytes += textureBytes(sprite.frames[i]);
+    return bytes;
+}
+
+void Graphics::reportMemory(MemoryReport& report) const {
+    report.add("textures", "wall.png", textureBytes(wallImage));
+    report.add("textures", "wall_dark.png", textureBytes(wallDarkImage));
+    report.add("textures", "spikes.png", textureBytes(spikeImage));
+    report.add("textures", "exit.png", textureBytes(exitImage));
+    report.add("textures", "coin/coin0-2.png", spriteBytes(coinSprite));
+    report.add("textures", "heart.png", textureBytes(heartImage));
+    report.add("textures", "player_stand_forward.png", textureBytes(playerStandForwardImage));
+    report.add("textures", "player_stand_backwards.png", textureBytes(playerStandBackwardsImage));
+    report.add("textures", "player_jump_forward.png", textureBytes(playerJumpForwardImage));
+    report.add("textures", "player_jump_backwards.png", textureBytes(playerJumpBackwardsImage));
+    report.add("textures", "player_dead.png", textureBytes(playerDeadImage));
+    report.add("textures", "player_walk_forward/player0-2.png", spriteBytes(playerWalkForwardSprite));
+    report.add("textures", "player_walk_backwards/player0-2.png", spriteBytes(playerWalkBackwardsSprite));
+    report.add("textures", "enemy_walk/enemy0-1.png", spriteBytes(enemyWalkSprite));
+    report.add("textures", "background/background.png", textureBytes(backgroundImage));
+    report.add("textures", "background/middleground.png", textureBytes(middlegroundImage));
+    report.add("textures", "background/foreground.png", textureBytes(foregroundImage));
+
+    report.add("fonts", "ARCADE_N.TTF atlases", menuFont->getMemoryUsage());
+
+    if (useRenderTarget) {
+        // Colour texture plus a 32-bit depth buffer.
+        report.add("graphics", "render target", textureBytes(renderTarget.texture) +
+                   static_cast<size_t>(renderTarget.texture.width) * renderTarget.texture.height * 4);
+    }
+    report.add("graphics", "victory balls", sizeof(victoryBalls));
+    report.add("graphics", "visible tiles", visibleTiles.capacity() * sizeof(VisibleTile));
+    report.add("graphics", "profiler history copy", profileHistory.capacity() * sizeof(uint32_t));
+    report.add("graphics", "renderer state", sizeof(Graphics) - sizeof(victoryBalls));
+}
+
+void Graphics::drawMemoryOverlay(const MemoryReport& report) {
+    const int fontSize = std::max(10, static_cast<int>(14.0f * screenScale));
+    const int lineHeight = fontSize + 2;
+    const int nameWidth = 20 * fontSize;
+    const int width = nameWidth + 8 * fontSize;
+    const int left = static_cast<int>(screenSize.x) - width - 4;
+    const int top = static_cast<int>(HUD_ICON_SIZE * screenScale) + 16;
+    const size_t LARGEST_SHOWN = 8;
+
+    MemoryReport::Subsystem subsystems[MemoryReport::MAX_SUBSYSTEMS];
+    size_t subsystemCount = report.getSubsystems(subsystems);
+    const std::vector<MemoryReport::Entry>& entries = report.getEntries();
+    size_t shown = std::min(entries.size(), LARGEST_SHOWN);
+
+    int height = static_cast<int>(subsystemCount + shown + 3) * lineHeight + 8;
+    DrawRectangle(left - 4, top - 4, width, height, {0, 0, 0, 180});
+
+    int y = top;
+    DrawText("memory", left, y, fontSize, GRAY);
+    DrawText(TextFormat("%.2f MiB", report.getTotal() / (1024.0 * 1024.0)), left + nameWidth, y, fontSize, YELLOW);
+    for (size_t i = 0; i < subsystemCount; i++) {
+        y += lineHeight;
+        DrawText(subsystems[i].name, left, y, fontSize, WHITE);
+        DrawText(TextFormat("%.1f KiB", subsystems[i].bytes / 1024.0), left + nameWidth, y, fontSize, WHITE);
+    }
+
+    // Largest entries, picked without sorting (or copying) the report.
+    y += lineHeight;
+    DrawText("largest", left, y, fontSize, GRAY);
+    size_t previousBytes = SIZE_MAX;
+    size_t previousIndex = SIZE_MAX;
+    for (size_t rank = 0; rank < shown; rank++) {
+        size_t best = SIZE_MAX;
+        for (size_t i = 0; i < entries.size(); i++) {
+            bool belowPrevious = entries[i].bytes < previousBytes ||
+                                 (entries[i].bytes == previousBytes && previousIndex != SIZE_MAX && i > previousIndex);
+            if (belowPrevious && (best == SIZE_MAX || entries[i].bytes > entries[best].bytes)) best = i;
+        }
+        if (best == SIZE_MAX) break;
+        previousBytes = entries[best].bytes;
+        previousIndex = best;
+        y += lineHeight;
+        DrawText(entries[best].name, left, y, fontSize, LIGHTGRAY);
+        DrawText(TextFormat("%.1f KiB", entries[best].bytes / 1024.0), left + nameWidth, y, fontSize, LIGHTGRAY);
+    }
+}
@@ -2,26 +2,44 @@
 #define GRAPHICS_H
 
 #include "raylib.h"
+#include "random.h"
+#include "visible_tiles.h"
 #include <vector>
 #include <string>
 #include <cstddef>
+#include <cstdint>
 
 class Level;
 class Player;
 class Enemy;
+class AssetArchive;
+class FontAtlas;
+class Profiler;
+class MemoryReport;
+struct GameOptions;
 
 class Graphics {
 public:
-    Graphics(Player* player);
+    Graphics(Player* player, const AssetArchive* assets, const GameOptions& options, uint64_t seed);
     ~Graphics();
 
+    void beginFrame();
+    void endFrame();
+
     void drawMenu();
-    void drawGame(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame);
-    void drawDeathScreen(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame);
+    void drawGame(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame, float alpha);
+    void drawDeathScreen(Level* level, const std::vector<Enemy*>& enemies, size_t gameFrame, float alpha);
     void drawGameOverMenu();
     void drawPauseMenu();
     void drawVictoryMenu(size_t gameFrame);
     void initializeVictoryBalls();
+    // Per-phase p50/p99/max table and frame-time graph, drawn over the frame.
+    void drawProfilerOverlay(const Profiler& profiler);
+    // Subsystem totals and the largest entries, drawn over the frame.
+    void drawMemoryOverlay(const MemoryReport& report);
+
+    // Textures, font atlases, the render target and the renderer's own buffers.
+    void reportMemory(MemoryReport& report) const;
 
 private:
     struct Text {
@@ -30,7 +48,7 @@ private:
         float size;
         Color color;
         float spacing;
-        Font* font;
+        FontAtlas* font;
     };
 
     struct Sprite {
@@ -54,11 +72,17 @@ private:
     void drawText(const Text& text);
     void drawSprite(Sprite& sprite, Vector2 pos, float size, size_t gameFrame);
     void drawImage(Texture2D image, Vector2 pos, float size);
+    static size_t textureBytes(const Texture2D& texture);
+    static size_t spriteBytes(const Sprite& sprite);
+    void updateScreenMetrics();
     void deriveMetricsFromLevel(Level* level);
-    void drawParallaxBackground(size_t gameFrame);
+    void resizeRenderTarget(int width, int height);
+    void updateDynamicResolution();
+    void drawParallaxBackground(size_t gameFrame, float cameraX);
+    static Vector2 interpolate(Vector2 from, Vector2 to, float alpha);
 
     // Assets
-    Font menuFont;
+    FontAtlas* menuFont;
     Texture2D wallImage;
     Texture2D wallDarkImage;
     Texture2D spikeImage;
@@ -87,15 +111,22 @@ private:
     Text victoryTitle;
     Text victorySubtitle;
 
+    static constexpr float HUD_ICON_SIZE = 48.0f;
+
     static const size_t VICTORY_BALL_COUNT = 2000;
     static constexpr float VICTORY_BALL_MAX_SPEED = 2.0f;
     static constexpr float VICTORY_BALL_MIN_RADIUS = 2.0f;
     static constexpr float VICTORY_BALL_MAX_RADIUS = 3.0f;
     static const Color VICTORY_BALL_COLOR;
     static const unsigned char VICTORY_BALL_TRAIL_TRANSPARENCY = 10;
+    // Longest catch-up after a stall, in ticks.
+    static constexpr size_t VICTORY_BALL_MAX_STEPS = 4;
     VictoryBall victoryBalls[VICTORY_BALL_COUNT];
+    // Tick the balls were last advanced to; SIZE_MAX until the first draw.
+    size_t victoryBallFrame;
 
     Player* player;
+    const AssetArchive* assets;
 
     Vector2 screenSize;
     float screenScale;
@@ -107,6 +138,29 @@ private:
     static constexpr float PARALLAX_PLAYER_SCROLLING_SPEED = 0.003f;
     static constexpr float PARALLAX_IDLE_SCROLLING_SPEED = 0.00005f;
     static constexpr float PARALLAX_LAYERED_SPEED_DIFFERENCE = 3.0f;
+
+    // Fixed internal resolution, presented with nearest or integer scaling.
+    bool useRenderTarget;
+    RenderTexture2D renderTarget;
+    Vector2 internalSize;
+    bool integerScaling;
+    bool dynamicResolution;
+    float resolutionScale;
+    float frameBudget;
+    float averageFrameTime;
+    int framesWithinBudget;
+    static constexpr float MIN_RESOLUTION_SCALE = 0.5f;
+    static constexpr float RESOLUTION_SCALE_STEP = 0.1f;
+    static constexpr float FRAME_TIME_SMOOTHING = 0.05f;
+    static constexpr float OVER_BUDGET_FACTOR = 1.2f;
+    static constexpr float WITHIN_BUDGET_FACTOR = 1.05f;
+    static const int FRAMES_BEFORE_UPSCALE = 120;
+
+    // Reused every frame by drawGame and the profiler overlay.
+    std::vector<VisibleTile> visibleTiles;
+    std::vector<uint32_t> profileHistory;
+
+    Random random;
 };
 
 #endif // GRAPHICS_H
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <cstdint>
+
+// Input consumed by one simulation tick. Held keys reflect the latest
+// polled state; pressed keys are latched until a tick consumes them, so a
+// press is neither lost nor repeated when a frame runs zero or several ticks.
+struct InputFrame {
+    enum Bit : uint8_t {
+        LEFT_BIT = 1 << 0,
+        RIGHT_BIT = 1 << 1,
+        JUMP_BIT = 1 << 2,
+        ENTER_BIT = 1 << 3,
+        ESCAPE_BIT = 1 << 4
+    };
+
+    bool left = false;
+    bool right = false;
+    bool jump = false;
+    bool enter = false;
+    bool escape = false;
+
+    void clearPresses() {
+        enter = false;
+        escape = false;
+    }
+
+    uint8_t toMask() const {
+        return (left ? LEFT_BIT : 0) | (right ? RIGHT_BIT : 0) | (jump ? JUMP_BIT : 0) |
+               (enter ? ENTER_BIT : 0) | (escape ? ESCAPE_BIT : 0);
+    }
+
+    static InputFrame fromMask(uint8_t mask) {
+        InputFrame input;
+        input.left = (mask & LEFT_BIT) != 0;
+        input.right = (mask & RIGHT_BIT) != 0;
+        input.jump = (mask & JUMP_BIT) != 0;
+        input.enter = (mask & ENTER_BIT) != 0;
+        input.escape = (mask & ESCAPE_BIT) != 0;
+        return input;
+    }
+};
+
+#endif // INPUT_H
\ No newline at end of file
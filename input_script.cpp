@@ -0,0 +1,116 @@
+#include "input_script.h"
+#include "simulation.h"
+#include "replay.h"
+#include "level.h"
+#include "player.h"
+#include "enemy.h"
+#include <cmath>
+
+InputScript::InputScript(const Replay* route)
+    : routeLevel(-1), routeTick(0), attempts(0), attemptStart(0), deathStart(0), onDeathScreen(false) {
+    if (route) {
+        learnRoute(*route);
+    }
+}
+
+void InputScript::learnRoute(const Replay& route) {
+    Replay cursor = route;
+    cursor.restart();
+    Simulation simulation(route.getSeed());
+    InputFrame input;
+    while (cursor.next(input)) {
+        Simulation::GameState state = simulation.getState();
+        if (state == Simulation::GAME_STATE || state == Simulation::LEVEL_TRANSITION_STATE) {
+            size_t level = static_cast<size_t>(simulation.getLevelIndex());
+            if (levelRoutes.size() <= level) levelRoutes.resize(level + 1);
+            levelRoutes[level].push_back(input.toMask());
+        }
+        simulation.step(input);
+    }
+}
+
+void InputScript::startAttempt(const Simulation& simulation) {
+    attempts++;
+    attemptStart = simulation.getGameFrame();
+    routeLevel = -1;
+}
+
+InputFrame InputScript::next(const Simulation& simulation) {
+    InputFrame input;
+    uint64_t frame = simulation.getGameFrame();
+
+    switch (simulation.getState()) {
+        case Simulation::MENU_STATE:
+        case Simulation::GAME_OVER_STATE:
+            input.enter = true;
+            startAttempt(simulation);
+            break;
+
+        case Simulation::DEATH_STATE:
+            if (!onDeathScreen) {
+                onDeathScreen = true;
+                deathStart = frame;
+            }
+            if (frame - deathStart >= RESTART_DELAY) {
+                input.enter = true;
+                onDeathScreen = false;
+                startAttempt(simulation);
+            }
+            break;
+
+        case Simulation::PAUSED_STATE:
+            input.escape = true;
+            break;
+
+        case Simulation::GAME_STATE:
+        case Simulation::LEVEL_TRANSITION_STATE:
+        {
+            if (attempts <= 1) {
+                input.right = true;
+                input.jump = (frame - attemptStart) % JUMP_PERIOD < JUMP_HOLD;
+                break;
+            }
+
+            int level = simulation.getLevelIndex();
+            if (level != routeLevel) {
+                routeLevel = level;
+                routeTick = 0;
+            }
+            if (static_cast<size_t>(level) < levelRoutes.size() && routeTick < levelRoutes[level].size()) {
+                InputFrame recorded = InputFrame::fromMask(levelRoutes[level][routeTick++]);
+                input.left = recorded.left;
+                input.right = recorded.right;
+                input.jump = recorded.jump;
+            } else {
+                input.right = true;
+                input.jump = hazardAhead(simulation);
+            }
+            break;
+        }
+    }
+    return input;
+}
+
+bool InputScript::hazardAhead(const Simulation& simulation) {
+    const Level* level = simulation.getLevel();
+    Vector2 position = simulation.getPlayer()->getPosition();
+    int row = static_cast<int>(std::round(position.y));
+    int front = static_cast<int>(std::floor(position.x)) + 1;
+    int reach = static_cast<int>(std::ceil(position.x + LOOKAHEAD));
+
+    auto tile = [level](int r, int c) {
+        return level->isInside(r, c) ? level->getCell(static_cast<size_t>(r), static_cast<size_t>(c)) : AIR;
+    };
+    for (int column = front; column <= reach; column++) {
+        if (tile(row, column) == WALL || tile(row, column) == SPIKE || tile(row + 1, column) != WALL) return true;
+    }
+
+    for (const Enemy* enemy : simulation.getEnemies()) {
+        Vector2 enemyPosition = enemy->getPosition();
+        float distance = enemyPosition.x - position.x;
+        if (distance > 0.0f && distance < LOOKAHEAD + 1.0f && std::fabs(enemyPosition.y - position.y) < 1.0f) {
+            return true;
+        }
+    }
+    return false;
+}
\ No newline at end of file
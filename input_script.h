@@ -0,0 +1,52 @@
+#ifndef INPUT_SCRIPT_H
+#define INPUT_SCRIPT_H
+
+#include "input.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class Simulation;
+class Replay;
+
+// Deterministic stand-in for a player, used by the benchmark mode. It starts
+// from the menu and always runs right. The first attempt hops blindly on a
+// fixed cadence, which ends in a death and a restart. Later attempts replay
+// the route for the current level, cut per level from a recorded run that
+// clears the pack (see tools/route_bot.cpp), so they clear the level even
+// though the timer and lives differ from the recording. Without a route, or
+// past its end, the script jumps at whatever is just ahead. Game over starts
+// a new run the same way.
+class InputScript {
+public:
+    explicit InputScript(const Replay* route = nullptr);
+
+    InputFrame next(const Simulation& simulation);
+
+    uint64_t getAttempts() const { return attempts; }
+    size_t getRouteLevelCount() const { return levelRoutes.size(); }
+
+private:
+    void learnRoute(const Replay& route);
+    void startAttempt(const Simulation& simulation);
+    static bool hazardAhead(const Simulation& simulation);
+
+    static const uint64_t JUMP_PERIOD = 45;
+    static const uint64_t JUMP_HOLD = 20;
+    // Tiles ahead of the player checked for walls, gaps, spikes and enemies.
+    static constexpr float LOOKAHEAD = 1.6f;
+    // Ticks spent on the death screen before pressing Enter.
+    static const uint64_t RESTART_DELAY = 30;
+
+    // Input masks of each level's ticks, from its first gameplay tick.
+    std::vector<std::vector<uint8_t>> levelRoutes;
+    int routeLevel;
+    size_t routeTick;
+
+    uint64_t attempts;
+    uint64_t attemptStart;
+    uint64_t deathStart;
+    bool onDeathScreen;
+};
+
+#endif // INPUT_SCRIPT_H
\ No newline at end of file
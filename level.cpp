@@ -1,140 +1,90 @@
 #include "level.h"
+#include "level_pack.h"
+#include "embedded_levels.h"
 #include "player.h"
 #include "enemy.h"
+#include "collision.h"
+#include "profiler.h"
+#include "trace.h"
+#include <algorithm>
 #include <cmath>
 #include <fstream>
-#include <sstream>
 #include <iostream>
 
-Level::LevelData Level::LEVELS[LEVEL_COUNT] = {
-    {12, 72, LEVEL_1_DATA},
-    {12, 78, LEVEL_2_DATA},
-    {12, 86, LEVEL_3_DATA}
-};
+const char* const Level::PACK_PATH = "data/levels.rll";
 
-Level::Level() : rows(0), columns(0), data(nullptr) {}
+Level::Level() : index(-1), rows(0), columns(0), data(nullptr), pristine(nullptr) {}
 
 Level::~Level() {
     unload();
 }
 
-void Level::load(int index) {
-    try {
-        loadFromRLL("data/levels.rll", index);
-    } catch (const LevelLoadException& e) {
-        unload();
-        rows = LEVELS[index].rows;
-        columns = LEVELS[index].columns;
-        data = new char[rows * columns];
-
-        for (size_t row = 0; row < rows; row++) {
-            for (size_t column = 0; column < columns; column++) {
-                data[row * columns + column] = LEVELS[index].data[row * columns + column];
-            }
-        }
-    }
+void Level::load(const LevelPack& pack, int levelIndex) {
+    TRACE_SCOPE("build level grid", "load");
+    const LevelPack::Layout& layout = pack.getLayout(levelIndex);
+    unload();
+    index = levelIndex;
+    rows = layout.rows;
+    columns = layout.columns;
+    data = new char[rows * columns];
+    std::copy(layout.cells.begin(), layout.cells.end(), data);
+    pristine = layout.cells.data();
+    isDirty.assign(rows * columns, false);
+    dirtyCells.reserve(DIRTY_CELL_RESERVE);
 }
 
-void Level::loadFromRLL(const std::string& filename, int levelIndex) {
-    std::vector<std::string> levels = parseRLLFile(filename);
-
-    if (levelIndex < 0 || levelIndex >= static_cast<int>(levels.size())) {
-        throw LevelLoadException("Invalid level index");
-    }
-
-    std::string decodedLevel = decodeRLEString(levels[levelIndex]);
-    createLevelFromRLE(decodedLevel);
+void Level::load(int levelIndex) {
+    load(LevelPack::standard(), levelIndex);
 }
 
-std::vector<std::string> Level::parseRLLFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw LevelLoadException("Could not open level file: " + filename);
-    }
-
-    std::vector<std::string> levels;
-    std::string line;
-    std::string currentLevel;
-
-    while (std::getline(file, line)) {
-        if (line.empty() || line[0] == ';') {
-            if (!currentLevel.empty()) {
-                levels.push_back(currentLevel);
-                currentLevel.clear();
-            }
-            continue;
-        }
-        currentLevel += line;
-    }
-
-    if (!currentLevel.empty()) {
-        levels.push_back(currentLevel);
-    }
-
-    if (levels.empty()) {
-        throw LevelLoadException("No levels found in file");
-    }
-
-    return levels;
+void Level::markDirty(size_t cell) {
+    if (isDirty[cell]) return;
+    isDirty[cell] = true;
+    dirtyCells.push_back(static_cast<uint32_t>(cell));
 }
 
-std::string Level::decodeRLEString(const std::string& rleString) {
-    std::string result;
-    std::string number;
-
-    for (size_t i = 0; i < rleString.length(); i++) {
-        char c = rleString[i];
-
-        if (isdigit(c)) {
-            number += c;
-        } else {
-            int count = number.empty() ? 1 : std::stoi(number);
-
-            if (c == '|') {
-                result += '\n';
-            } else {
-                result.append(count, c);
-            }
-            number.clear();
+void Level::captureChanges(std::vector<CellChange>& changes) const {
+    changes.clear();
+    for (uint32_t cell : dirtyCells) {
+        if (data[cell] != pristine[cell]) {
+            changes.push_back({cell, data[cell]});
         }
     }
-
-    return result;
 }
 
-void Level::createLevelFromRLE(const std::string& decodedLevel) {
-    unload();
-
-    std::istringstream stream(decodedLevel);
-    std::vector<std::string> levelRows;
-    std::string row;
-
-    size_t maxWidth = 0;
-    while (std::getline(stream, row)) {
-        levelRows.push_back(row);
-        maxWidth = std::max(maxWidth, row.length());
-    }
-
-    rows = levelRows.size();
-    columns = maxWidth;
-
-    if (rows == 0 || columns == 0) {
-        throw LevelLoadException("Invalid level dimensions");
+void Level::restoreChanges(const std::vector<CellChange>& changes) {
+    for (uint32_t cell : dirtyCells) {
+        data[cell] = pristine[cell];
+        isDirty[cell] = false;
     }
-
-    data = new char[rows * columns];
-
-    for (size_t i = 0; i < rows * columns; i++) {
-        data[i] = AIR;
+    dirtyCells.clear();
+    for (const CellChange& change : changes) {
+        data[change.index] = change.value;
+        markDirty(change.index);
     }
+}
 
-    // Copy level data
-    for (size_t row = 0; row < rows; row++) {
-        const std::string& currentRow = levelRows[row];
-        for (size_t col = 0; col < currentRow.length(); col++) {
-            data[row * columns + col] = currentRow[col];
+uint64_t Level::hashPack() {
+    // FNV-1a over the .rll text the game would load: the file, or the copy
+    // embedded at build time when the file is missing, so both hash alike.
+    uint64_t hash = 0xCBF29CE484222325ull;
+    auto feed = [&hash](unsigned char byte) {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    };
+
+    std::ifstream file(PACK_PATH, std::ios::binary);
+    if (file.is_open()) {
+        char byte;
+        while (file.get(byte)) {
+            feed(static_cast<unsigned char>(byte));
+        }
+    } else {
+        for (size_t i = 0; i < EmbeddedLevels::TEXT_LENGTH; i++) {
+            feed(static_cast<unsigned char>(EMBEDDED_LEVELS_RLL[i]));
         }
     }
+    return hash;
 }
 
 void Level::unload() {
@@ -142,10 +92,18 @@ void Level::unload() {
         delete[] data;
         data = nullptr;
     }
+    pristine = nullptr;
+    dirtyCells.clear();
+    isDirty.clear();
+    index = -1;
     rows = 0;
     columns = 0;
 }
 
+size_t Level::getMemoryUsage() const {
+    return rows * columns + isDirty.capacity() / 8 + dirtyCells.capacity() * sizeof(uint32_t);
+}
+
 bool Level::isInside(int row, int column) const {
     if (row < 0 || row >= static_cast<int>(rows)) return false;
     if (column < 0 || column >= static_cast<int>(columns)) return false;
@@ -153,6 +111,7 @@ bool Level::isInside(int row, int column) const {
 }
 
 bool Level::isColliding(Vector2 pos, char lookFor) const {
+    PROFILE_SCOPE(COLLISION);
     Rectangle entityHitbox = {pos.x, pos.y, 1.0f, 1.0f};
 
     for (int row = static_cast<int>(floor(pos.y)) - 1; row <= static_cast<int>(floor(pos.y)) + 1; ++row) {
@@ -160,7 +119,7 @@ bool Level::isColliding(Vector2 pos, char lookFor) const {
             if (!isInside(row, column)) continue;
             if (getCell(row, column) == lookFor) {
                 Rectangle blockHitbox = {(float)column, (float)row, 1.0f, 1.0f};
-                if (CheckCollisionRecs(entityHitbox, blockHitbox)) {
+                if (rectanglesOverlap(entityHitbox, blockHitbox)) {
                     return true;
                 }
             }
@@ -170,6 +129,7 @@ bool Level::isColliding(Vector2 pos, char lookFor) const {
 }
 
 char& Level::getCollider(Vector2 pos, char lookFor) {
+    PROFILE_SCOPE(COLLISION);
     Rectangle playerHitbox = {pos.x, pos.y, 1.0f, 1.0f};
 
     for (int row = static_cast<int>(floor(pos.y)) - 1; row <= static_cast<int>(floor(pos.y)) + 1; ++row) {
@@ -177,7 +137,8 @@ char& Level::getCollider(Vector2 pos, char lookFor) {
             if (!isInside(row, column)) continue;
             if (getCell(row, column) == lookFor) {
                 Rectangle blockHitbox = {(float)column, (float)row, 1.0f, 1.0f};
-                if (CheckCollisionRecs(playerHitbox, blockHitbox)) {
+                if (rectanglesOverlap(playerHitbox, blockHitbox)) {
+                    markDirty(row * columns + column);
                     return getCell(row, column);
                 }
             }
@@ -195,5 +156,6 @@ const char& Level::getCell(size_t row, size_t column) const {
 }
 
 void Level::setCell(size_t row, size_t column, char chr) {
+    markDirty(row * columns + column);
     data[row * columns + column] = chr;
 }
\ No newline at end of file
@@ -7,19 +7,35 @@
 #include <cstddef>
 #include <string>
 #include <stdexcept>
+#include <cstdint>
 
 class Player;
 class Enemy;
+class LevelPack;
 
 class Level {
 public:
+    static const char* const PACK_PATH;
+
     Level();
     ~Level();
 
+    // Copies a layout out of the pack; the pack must outlive the level.
+    void load(const LevelPack& pack, int index);
     void load(int index);
-    void loadFromRLL(const std::string& filename, int levelIndex);
     void unload();
 
+    static uint64_t hashPack();
+
+    // Cells are mutated only through setCell() and getCollider(); both log the
+    // cell as dirty so snapshots can store a diff against the pristine level.
+    struct CellChange {
+        uint32_t index;
+        char value;
+    };
+    void captureChanges(std::vector<CellChange>& changes) const;
+    void restoreChanges(const std::vector<CellChange>& changes);
+
     bool isInside(int row, int column) const;
     bool isColliding(Vector2 pos, char lookFor) const;
     char& getCollider(Vector2 pos, char lookFor);
@@ -27,9 +43,13 @@ public:
     const char& getCell(size_t row, size_t column) const;
     void setCell(size_t row, size_t column, char chr);
 
+    int getIndex() const { return index; }
+    bool isLoaded() const { return data != nullptr; }
     size_t getRows() const { return rows; }
     size_t getColumns() const { return columns; }
     char* getData() const { return data; }
+    // The grid plus its dirty-cell tracking; the pristine cells belong to the pack.
+    size_t getMemoryUsage() const;
     char getWallChar() const { return WALL; }
     char getWallDarkChar() const { return WALL_DARK; }
     char getSpikeChar() const { return SPIKE; }
@@ -40,21 +60,22 @@ public:
     char getAirChar() const { return AIR; }
 
 private:
-    struct LevelData {
-        size_t rows;
-        size_t columns;
-        char* data;
-    };
-    static LevelData LEVELS[LEVEL_COUNT];
+    void markDirty(size_t cell);
 
-    std::vector<std::string> parseRLLFile(const std::string& filename);
-    std::string decodeRLEString(const std::string& rleString);
-    void parseLevelDimensions(const std::string& decodedLevel);
-    void createLevelFromRLE(const std::string& decodedLevel);
+    // dirtyCells capacity kept from level to level, so collecting coins
+    // does not grow it during play.
+    static constexpr size_t DIRTY_CELL_RESERVE = 1024;
 
+    int index;
     size_t rows;
     size_t columns;
     char* data;
+    const char* pristine;
+    // Cells that may differ from pristine. isDirty keeps each cell listed
+    // once, since restoreChanges re-marks every restored cell on rewind and
+    // quick load.
+    std::vector<uint32_t> dirtyCells;
+    std::vector<bool> isDirty;
 };
 
 class LevelLoadException : public std::runtime_error {
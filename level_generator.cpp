@@ -0,0 +1,113 @@
+#include "level_generator.h"
+#include "level.h"
+#include "random.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// Columns kept free of hazards around the spawn and the exit.
+const size_t SAFE_COLUMNS = 6;
+const size_t MIN_GROUND = 1;
+const size_t MAX_GROUND = 6;
+const size_t PLATFORM_HEIGHT = 4;
+
+bool chance(Random& random, float probability) {
+    return random.nextFloat() < probability;
+}
+
+size_t below(Random& random, size_t bound) {
+    return static_cast<size_t>(random.next() % bound);
+}
+
+}
+
+LevelPack::Layout LevelGenerator::generate(const Parameters& parameters) {
+    const size_t rows = parameters.rows;
+    const size_t columns = parameters.columns;
+    if (rows < MIN_ROWS || rows > MAX_ROWS) {
+        throw LevelLoadException("Generated levels need " + std::to_string(MIN_ROWS) + " to " +
+                                 std::to_string(MAX_ROWS) + " rows");
+    }
+    if (columns < MIN_COLUMNS || columns > MAX_COLUMNS) {
+        throw LevelLoadException("Generated levels need " + std::to_string(MIN_COLUMNS) + " to " +
+                                 std::to_string(MAX_COLUMNS) + " columns");
+    }
+
+    Random random(Random::derive(parameters.seed, Random::SIMULATION_STREAM));
+    LevelPack::Layout layout = {rows, columns, std::vector<char>(rows * columns, AIR)};
+    auto cell = [&layout](size_t row, size_t column) -> char& { return layout.cells[row * layout.columns + column]; };
+
+    // Ground height per column as a random walk in one-tile steps, flat
+    // around the spawn and the exit.
+    const size_t maxGround = std::min(MAX_GROUND, rows - PLATFORM_HEIGHT - 2);
+    std::vector<uint8_t> ground(columns, MIN_GROUND);
+    size_t height = MIN_GROUND;
+    for (size_t column = 0; column < columns; column++) {
+        bool safe = column < SAFE_COLUMNS || column + SAFE_COLUMNS >= columns;
+        if (!safe && chance(random, parameters.wallDensity * 0.5f)) {
+            if (height > MIN_GROUND && (height == maxGround || chance(random, 0.5f))) {
+                height--;
+            } else if (height < maxGround) {
+                height++;
+            }
+        }
+        ground[column] = static_cast<uint8_t>(safe ? MIN_GROUND : height);
+    }
+
+    // Solid ground: '#' where the player can touch it, '=' decoration inside.
+    for (size_t column = 0; column < columns; column++) {
+        size_t left = column > 0 ? ground[column - 1] : ground[column];
+        size_t right = column + 1 < columns ? ground[column + 1] : ground[column];
+        for (size_t depth = 1; depth <= ground[column]; depth++) {
+            bool exposed = depth == ground[column] || depth == 1 || depth > left || depth > right;
+            cell(rows - depth, column) = exposed ? WALL : WALL_DARK;
+        }
+    }
+    auto surface = [&](size_t column) { return rows - ground[column] - 1; };
+
+    // Floating platforms with at least two tiles of head room underneath.
+    for (size_t column = SAFE_COLUMNS; column + SAFE_COLUMNS < columns; column++) {
+        if (!chance(random, parameters.wallDensity * 0.1f)) continue;
+        size_t row = surface(column) - PLATFORM_HEIGHT + 1;
+        size_t length = 3 + below(random, 6);
+        for (size_t end = std::min(columns - SAFE_COLUMNS, column + length); column < end; column++) {
+            if (row + 2 < surface(column)) cell(row, column) = WALL;
+        }
+    }
+
+    // Spikes on the ground in runs of at most two, and coins floating one to
+    // three tiles above the ground or on platforms.
+    size_t spikeRun = 0;
+    for (size_t column = SAFE_COLUMNS; column + SAFE_COLUMNS < columns; column++) {
+        bool flat = ground[column - 1] == ground[column] && ground[column + 1] == ground[column];
+        if (flat && spikeRun < 2 && chance(random, parameters.spikeDensity)) {
+            cell(surface(column), column) = SPIKE;
+            spikeRun++;
+        } else {
+            spikeRun = 0;
+        }
+        if (chance(random, parameters.coinDensity)) {
+            size_t row = surface(column) - below(random, 3) - 1;
+            if (cell(row, column) == AIR && cell(row + 1, column) != SPIKE) cell(row, column) = COIN;
+        }
+    }
+
+    // Enemies on free ground tiles; more enemies than tiles stops early.
+    // Levels too narrow for a band clear of both safe zones get none.
+    size_t placed = 0;
+    size_t span = columns > 3 * SAFE_COLUMNS ? columns - 3 * SAFE_COLUMNS : 0;
+    for (size_t attempt = 0; span > 0 && placed < parameters.enemyCount && attempt < parameters.enemyCount * 8;
+         attempt++) {
+        size_t column = 2 * SAFE_COLUMNS + below(random, span);
+        char& target = cell(surface(column), column);
+        if (target == AIR) {
+            target = ENEMY;
+            placed++;
+        }
+    }
+
+    cell(surface(1), 1) = PLAYER;
+    cell(surface(columns - 3), columns - 3) = EXIT;
+    return layout;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef LEVEL_GENERATOR_H
+#define LEVEL_GENERATOR_H
+
+#include "level_pack.h"
+#include <cstddef>
+#include <cstdint>
+
+// Seeded procedural levels in the shipped tile alphabet, for stress tests and
+// scaling benchmarks far beyond the hand-made levels. The same parameters
+// always produce the same layout. Terrain steps are at most one tile and
+// spike runs at most two, so levels stay traversable, but solvability is
+// not guaranteed; tools/level_analyzer can check it.
+class LevelGenerator {
+public:
+    struct Parameters {
+        size_t rows = 12;
+        size_t columns = 72;
+        float wallDensity = 0.15f;   // terrain roughness and floating platforms
+        float spikeDensity = 0.05f;  // chance of a spike per ground column
+        float coinDensity = 0.10f;   // chance of a coin per column
+        size_t enemyCount = 4;
+        uint64_t seed = 1;
+    };
+
+    static const size_t MIN_ROWS = 8;
+    static const size_t MAX_ROWS = 64;
+    static const size_t MIN_COLUMNS = 16;
+    static const size_t MAX_COLUMNS = 1000000;
+
+    // Throws LevelLoadException when the parameters are out of range.
+    static LevelPack::Layout generate(const Parameters& parameters);
+};
+
+#endif // LEVEL_GENERATOR_H
\ No newline at end of file
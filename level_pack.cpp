@@ -0,0 +1,219 @@
+#include "level_pack.h"
+#include "level.h"
+#include "embedded_levels.h"
+#include "arena.h"
+#include "trace.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+LevelPack LevelPack::fromFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw LevelLoadException("Could not open level file: " + filename);
+    }
+    Arena::Scope scope(Arena::load());
+    ArenaVector<char> text{ArenaAllocator<char>(Arena::load())};
+    {
+        TRACE_SCOPE("read level pack", "load", filename.c_str());
+        // Sized up front when the file is seekable; pipes and process
+        // substitutions are read in chunks until end of file.
+        std::streamoff size = file.seekg(0, std::ios::end).tellg();
+        if (size > 0) text.reserve(static_cast<size_t>(size));
+        file.clear();
+        file.seekg(0, std::ios::beg);
+        file.clear();
+
+        const size_t CHUNK_SIZE = 64 * 1024;
+        size_t length = 0;
+        while (file) {
+            text.resize(length + CHUNK_SIZE);
+            file.read(text.data() + length, static_cast<std::streamsize>(CHUNK_SIZE));
+            length += static_cast<size_t>(file.gcount());
+        }
+        if (file.bad()) {
+            throw LevelLoadException("Could not read level file: " + filename);
+        }
+        text.resize(length);
+    }
+    return fromText(text.data(), text.size());
+}
+
+LevelPack LevelPack::fromString(const std::string& text) {
+    return fromText(text.data(), text.size());
+}
+
+LevelPack LevelPack::fromText(const char* text, size_t length) {
+    // Levels are separated by blank or ';' comment lines; one level may be
+    // split over several lines.
+    TRACE_SCOPE("decode level pack", "load");
+    LevelPack pack;
+    Arena::Scope scope(Arena::load());
+    ArenaString currentLevel{ArenaAllocator<char>(Arena::load())};
+    currentLevel.reserve(length);
+
+    const char* end = text + length;
+    for (const char* line = text; line < end;) {
+        const char* lineEnd = std::find(line, end, '\n');
+        const char* next = lineEnd < end ? lineEnd + 1 : end;
+        if (lineEnd > line && lineEnd[-1] == '\r') lineEnd--;
+
+        if (lineEnd == line || line[0] == ';') {
+            if (!currentLevel.empty()) {
+                pack.layouts.push_back(decodeLayout(currentLevel.data(), currentLevel.size()));
+                currentLevel.clear();
+            }
+        } else {
+            currentLevel.append(line, lineEnd);
+        }
+        line = next;
+    }
+
+    if (!currentLevel.empty()) {
+        pack.layouts.push_back(decodeLayout(currentLevel.data(), currentLevel.size()));
+    }
+
+    if (pack.layouts.empty()) {
+        throw LevelLoadException("No levels found in file");
+    }
+
+    return pack;
+}
+
+LevelPack LevelPack::builtIn() {
+    LevelPack pack;
+    for (const EmbeddedLevels::Level& level : EmbeddedLevels::LEVELS) {
+        pack.layouts.push_back({level.rows, level.columns,
+                                std::vector<char>(level.cells, level.cells + level.rows * level.columns)});
+    }
+    return pack;
+}
+
+const LevelPack& LevelPack::standard() {
+    static const LevelPack pack = [] {
+        try {
+            LevelPack loaded = fromFile(Level::PACK_PATH);
+            if (loaded.getLevelCount() >= static_cast<size_t>(LEVEL_COUNT)) {
+                return loaded;
+            }
+        } catch (const LevelLoadException&) {
+        }
+        return builtIn();
+    }();
+    return pack;
+}
+
+size_t LevelPack::getMemoryUsage() const {
+    size_t total = layouts.capacity() * sizeof(Layout);
+    for (const Layout& layout : layouts) total += layout.cells.capacity();
+    return total;
+}
+
+const LevelPack::Layout& LevelPack::getLayout(int index) const {
+    if (index < 0 || index >= static_cast<int>(layouts.size())) {
+        throw LevelLoadException("Invalid level index");
+    }
+    return layouts[index];
+}
+
+std::string LevelPack::toString() const {
+    std::string text;
+    for (size_t i = 0; i < layouts.size(); i++) {
+        text += "; Level " + std::to_string(i + 1) + "\n";
+        text += encodeLayout(layouts[i]);
+        text += '\n';
+    }
+    return text;
+}
+
+bool LevelPack::isTile(char c) {
+    return c == WALL || c == WALL_DARK || c == AIR || c == SPIKE || c == PLAYER || c == ENEMY || c == COIN ||
+           c == EXIT;
+}
+
+std::string LevelPack::encodeLayout(const Layout& layout) {
+    std::string rle;
+    for (size_t row = 0; row < layout.rows; row++) {
+        if (row > 0) rle += '|';
+        const char* cells = layout.cells.data() + row * layout.columns;
+        for (size_t column = 0; column < layout.columns;) {
+            size_t run = 1;
+            while (column + run < layout.columns && cells[column + run] == cells[column]) run++;
+            if (run > 1) rle += std::to_string(run);
+            rle += cells[column];
+            column += run;
+        }
+    }
+    return rle;
+}
+
+LevelPack::Layout LevelPack::decodeLayout(const std::string& rle) {
+    return decodeLayout(rle.data(), rle.size());
+}
+
+LevelPack::Layout LevelPack::decodeLayout(const char* rle, size_t length) {
+    // First pass validates and measures each row, second writes the cells
+    // straight into the layout; only the row widths need scratch space.
+    TRACE_SCOPE("decode level", "load");
+    Arena::Scope scope(Arena::load());
+    ArenaVector<size_t> rowWidths(1, 0, ArenaAllocator<size_t>(Arena::load()));
+    size_t count = 0;
+    bool hasCount = false;
+
+    for (const char* c = rle; c < rle + length; c++) {
+        if (isdigit(static_cast<unsigned char>(*c))) {
+            count = count * 10 + static_cast<size_t>(*c - '0');
+            hasCount = true;
+            if (count > MAX_RUN_LENGTH) {
+                throw LevelLoadException("Run length too large");
+            }
+        } else if (*c == '|') {
+            if (hasCount) {
+                throw LevelLoadException("Run length before row separator");
+            }
+            rowWidths.push_back(0);
+        } else if (isTile(*c)) {
+            if (hasCount && count == 0) {
+                throw LevelLoadException("Zero run length");
+            }
+            rowWidths.back() += hasCount ? count : 1;
+            count = 0;
+            hasCount = false;
+        } else {
+            throw LevelLoadException(std::string("Unknown tile '") + *c + "'");
+        }
+    }
+    if (hasCount) {
+        throw LevelLoadException("Run length at end of level");
+    }
+    // A trailing separator does not start another row.
+    if (rowWidths.size() > 1 && rowWidths.back() == 0) {
+        rowWidths.pop_back();
+    }
+
+    size_t maxWidth = *std::max_element(rowWidths.begin(), rowWidths.end());
+    Layout layout = {rowWidths.size(), maxWidth, {}};
+    if (layout.rows == 0 || layout.columns == 0) {
+        throw LevelLoadException("Invalid level dimensions");
+    }
+
+    // Short rows are padded with air.
+    layout.cells.assign(layout.rows * layout.columns, AIR);
+    size_t row = 0;
+    size_t column = 0;
+    count = 0;
+    for (const char* c = rle; c < rle + length && row < layout.rows; c++) {
+        if (isdigit(static_cast<unsigned char>(*c))) {
+            count = count * 10 + static_cast<size_t>(*c - '0');
+        } else if (*c == '|') {
+            row++;
+            column = 0;
+        } else {
+            size_t run = count > 0 ? count : 1;
+            std::fill_n(layout.cells.begin() + row * layout.columns + column, run, *c);
+            column += run;
+            count = 0;
+        }
+    }
+    return layout;
+}
@@ -0,0 +1,55 @@
+#ifndef LEVEL_PACK_H
+#define LEVEL_PACK_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+// Decoded layouts of every level in a pack. Parsed once and then only read,
+// so one pack can back any number of Level instances, including instances
+// running on different threads. A pack must outlive the Levels loaded from it.
+class LevelPack {
+public:
+    struct Layout {
+        size_t rows;
+        size_t columns;
+        std::vector<char> cells;
+    };
+
+    // Throws LevelLoadException when the file is missing or malformed.
+    static LevelPack fromFile(const std::string& filename);
+    static LevelPack fromString(const std::string& text);
+    static LevelPack builtIn();
+    // Level::PACK_PATH, or the built-in levels when it cannot be used.
+    // Loaded on first use; safe to call from several threads.
+    static const LevelPack& standard();
+
+    size_t getLevelCount() const { return layouts.size(); }
+    size_t getMemoryUsage() const;
+    const Layout& getLayout(int index) const;
+    void addLayout(const Layout& layout) { layouts.push_back(layout); }
+
+    // Canonical .rll text: a "; Level N" comment and one encoded line per level.
+    std::string toString() const;
+
+    // Run-length encoding of one level, see Readme.md. The canonical form
+    // writes every run of two or more tiles as count and tile, and every
+    // row at full width, so decodeLayout(encodeLayout(x)) == x.
+    static std::string encodeLayout(const Layout& layout);
+    // Throws LevelLoadException on unknown tiles, dangling or zero counts
+    // and empty levels.
+    static Layout decodeLayout(const std::string& rle);
+    static Layout decodeLayout(const char* rle, size_t length);
+    static bool isTile(char c);
+
+    // Covers a full row of the widest generated level, see level_generator.h.
+    static const size_t MAX_RUN_LENGTH = 1 << 20;
+
+private:
+    // Parsing scratch comes from Arena::load(), released when parsing ends.
+    static LevelPack fromText(const char* text, size_t length);
+
+    std::vector<Layout> layouts;
+};
+
+#endif // LEVEL_PACK_H
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "memory_report.h"
+#include <algorithm>
+#include <cstring>
+
+const char* const MemoryReport::DEFAULT_PATH = "memory.txt";
+
+void MemoryReport::add(const char* subsystem, const char* name, size_t bytes) {
+    entries.push_back({subsystem, name, bytes});
+}
+
+size_t MemoryReport::getTotal() const {
+    size_t total = 0;
+    for (const Entry& entry : entries) total += entry.bytes;
+    return total;
+}
+
+size_t MemoryReport::getSubsystems(Subsystem (&subsystems)[MAX_SUBSYSTEMS]) const {
+    size_t count = 0;
+    for (const Entry& entry : entries) {
+        size_t i = 0;
+        while (i < count && std::strcmp(subsystems[i].name, entry.subsystem) != 0) i++;
+        if (i == count) {
+            // Past the limit everything is lumped into the last subsystem.
+            if (count == MAX_SUBSYSTEMS) {
+                i = count - 1;
+            } else {
+                subsystems[count++] = {entry.subsystem, 0, 0};
+            }
+        }
+        subsystems[i].bytes += entry.bytes;
+        subsystems[i].entries++;
+    }
+    return count;
+}
+
+void MemoryReport::print(FILE* file) const {
+    std::fprintf(file, "MEMORY %zu bytes (%.2f MiB) in %zu entries\n", getTotal(), getTotal() / (1024.0 * 1024.0),
+                 entries.size());
+
+    Subsystem subsystems[MAX_SUBSYSTEMS];
+    size_t count = getSubsystems(subsystems);
+    for (size_t i = 0; i < count; i++) {
+        std::fprintf(file, "  %-16s %12zu bytes\n", subsystems[i].name, subsystems[i].bytes);
+    }
+
+    std::vector<Entry> sorted = entries;
+    std::stable_sort(sorted.begin(), sorted.end(), [&subsystems, count](const Entry& a, const Entry& b) {
+        auto rank = [&subsystems, count](const char* name) {
+            size_t i = 0;
+            while (i < count && std::strcmp(subsystems[i].name, name) != 0) i++;
+            return i;
+        };
+        size_t rankA = rank(a.subsystem);
+        size_t rankB = rank(b.subsystem);
+        return rankA != rankB ? rankA < rankB : a.bytes > b.bytes;
+    });
+    const char* current = nullptr;
+    for (const Entry& entry : sorted) {
+        if (!current || std::strcmp(current, entry.subsystem) != 0) {
+            current = entry.subsystem;
+            std::fprintf(file, "%s\n", current);
+        }
+        std::fprintf(file, "  %-40s %12zu bytes\n", entry.name, entry.bytes);
+    }
+}
+
+bool MemoryReport::writeFile(const std::string& filename) const {
+    FILE* file = std::fopen(filename.c_str(), "w");
+    if (!file) return false;
+    print(file);
+    return std::fclose(file) == 0;
+}
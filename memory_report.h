@@ -0,0 +1,47 @@
+#ifndef MEMORY_REPORT_H
+#define MEMORY_REPORT_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Where the running game's memory goes: one entry per asset, container or
+// buffer, grouped by subsystem. GPU and audio entries are the size of the
+// uploaded data, not whatever the driver adds. Subsystem and entry names must
+// be string literals, so the report can be rebuilt every frame for the
+// overlay without allocating once its entry list has grown.
+class MemoryReport {
+public:
+    struct Entry {
+        const char* subsystem;
+        const char* name;
+        size_t bytes;
+    };
+
+    struct Subsystem {
+        const char* name;
+        size_t bytes;
+        size_t entries;
+    };
+
+    static const char* const DEFAULT_PATH;
+    static constexpr size_t MAX_SUBSYSTEMS = 16;
+
+    void clear() { entries.clear(); }
+    void add(const char* subsystem, const char* name, size_t bytes);
+
+    const std::vector<Entry>& getEntries() const { return entries; }
+    size_t getTotal() const;
+    // Subsystems in the order they were first reported; returns the count.
+    size_t getSubsystems(Subsystem (&subsystems)[MAX_SUBSYSTEMS]) const;
+
+    // Subsystem totals, then every entry, largest first within a subsystem.
+    void print(FILE* file) const;
+    bool writeFile(const std::string& filename) const;
+
+private:
+    std::vector<Entry> entries;
+};
+
+#endif // MEMORY_REPORT_H
@@ -0,0 +1,129 @@
+#include "options.h"
+#include <cstdio>
+
+namespace {
+
+const char* requireValue(int argc, char** argv, int& i) {
+    if (i + 1 >= argc) {
+        throw OptionsException(std::string("Missing value for ") + argv[i]);
+    }
+    return argv[++i];
+}
+
+float parseFloat(const std::string& option, const char* value) {
+    try {
+        return std::stof(value);
+    } catch (const std::exception&) {
+        throw OptionsException("Invalid number for " + option + ": " + value);
+    }
+}
+
+}
+
+GameOptions GameOptions::parse(int argc, char** argv) {
+    GameOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+
+        if (option == "--render-size") {
+            const char* value = requireValue(argc, argv, i);
+            if (std::sscanf(value, "%dx%d", &options.renderWidth, &options.renderHeight) != 2 ||
+                options.renderWidth <= 0 || options.renderHeight <= 0) {
+                throw OptionsException(std::string("Invalid render size: ") + value);
+            }
+        } else if (option == "--render-scale") {
+            std::string value = requireValue(argc, argv, i);
+            if (value == "integer") {
+                options.integerScaling = true;
+            } else if (value == "nearest") {
+                options.integerScaling = false;
+            } else {
+                throw OptionsException("Invalid render scale: " + value);
+            }
+        } else if (option == "--dynamic-resolution") {
+            options.dynamicResolution = true;
+        } else if (option == "--frame-budget-ms") {
+            options.frameBudgetMs = parseFloat(option, requireValue(argc, argv, i));
+            if (options.frameBudgetMs <= 0.0f) {
+                throw OptionsException("Frame budget must be positive");
+            }
+        } else if (option == "--seed") {
+            const char* value = requireValue(argc, argv, i);
+            try {
+                options.seed = std::stoull(value, nullptr, 0);
+            } catch (const std::exception&) {
+                throw OptionsException(std::string("Invalid seed: ") + value);
+            }
+            options.hasSeed = true;
+        } else if (option == "--record") {
+            options.recordPath = requireValue(argc, argv, i);
+        } else if (option == "--replay") {
+            options.replayPath = requireValue(argc, argv, i);
+        } else if (option == "--benchmark") {
+            const char* value = requireValue(argc, argv, i);
+            try {
+                options.benchmarkFrames = std::stoull(value);
+            } catch (const std::exception&) {
+                throw OptionsException(std::string("Invalid frame count: ") + value);
+            }
+            if (options.benchmarkFrames == 0) {
+                throw OptionsException("Benchmark frame count must be positive");
+            }
+        } else if (option == "--benchmark-level") {
+            const char* value = requireValue(argc, argv, i);
+            try {
+                options.benchmarkLevel = std::stoi(value) - 1;
+            } catch (const std::exception&) {
+                throw OptionsException(std::string("Invalid level: ") + value);
+            }
+        } else if (option == "--benchmark-report") {
+            options.benchmarkReportPath = requireValue(argc, argv, i);
+        } else if (option == "--headless") {
+            options.headless = true;
+        } else if (option == "--zero-alloc") {
+            options.zeroAlloc = true;
+        } else if (option == "--trace") {
+            options.tracePath = requireValue(argc, argv, i);
+        } else if (option == "--telemetry") {
+            options.telemetryPath = requireValue(argc, argv, i);
+        } else {
+            throw OptionsException("Unknown option: " + option);
+        }
+    }
+
+    if (!options.replayPath.empty() && options.hasSeed) {
+        throw OptionsException("--seed cannot be combined with --replay; the replay stores its own seed");
+    }
+    if (options.dynamicResolution && options.renderWidth == 0) {
+        throw OptionsException("--dynamic-resolution requires --render-size");
+    }
+    if (options.benchmarkFrames == 0 &&
+        (options.headless || options.benchmarkLevel != 0 || !options.benchmarkReportPath.empty())) {
+        throw OptionsException("--headless, --benchmark-level and --benchmark-report require --benchmark");
+    }
+    if (options.benchmarkLevel != 0 && !options.replayPath.empty()) {
+        throw OptionsException("--benchmark-level cannot be combined with --replay; the replay starts at level 1");
+    }
+
+    return options;
+}
+
+const char* GameOptions::usage() {
+    return "Usage: platformer [options]\n"
+           "  --render-size WxH        render into a fixed WxH target and upscale it to the window\n"
+           "  --render-scale MODE      'nearest' (fit, default) or 'integer' scaling of the render target\n"
+           "  --dynamic-resolution     lower the render target size while frames exceed the budget\n"
+           "  --frame-budget-ms MS     frame time budget for dynamic resolution (default 16.67)\n"
+           "  --seed N                 seed the run's random number generators\n"
+           "  --record FILE            record every tick's input to FILE for later replay\n"
+           "  --replay FILE            play back a recorded run instead of reading the keyboard\n"
+           "  --benchmark N            run N uncapped frames of scripted play (or of --replay) and report\n"
+           "                           frame times, time per game state and allocations\n"
+           "  --benchmark-level N      start the benchmark at level N (default 1)\n"
+           "  --benchmark-report FILE  also write the benchmark report as JSON to FILE\n"
+           "  --headless               benchmark without a window, audio or drawing\n"
+           "  --zero-alloc             abort with a per-phase report when a gameplay frame allocates\n"
+           "  --trace FILE             write a Chrome trace (ui.perfetto.dev) of frames, loads and state changes\n"
+           "  --telemetry FILE         write every gameplay event to FILE as CSV\n";
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <string>
+#include <stdexcept>
+#include <cstdint>
+
+struct GameOptions {
+    // Internal render target size; 0x0 renders straight to the window.
+    int renderWidth = 0;
+    int renderHeight = 0;
+    bool integerScaling = false;
+    bool dynamicResolution = false;
+    float frameBudgetMs = 1000.0f / 60.0f;
+
+    bool hasSeed = false;
+    uint64_t seed = 0;
+    std::string recordPath;
+    std::string replayPath;
+
+    // --benchmark: run this many uncapped frames driven by an InputScript.
+    uint64_t benchmarkFrames = 0;
+    int benchmarkLevel = 0;
+    std::string benchmarkReportPath;
+    // No window, audio or drawing; only valid with --benchmark.
+    bool headless = false;
+    // Abort on any heap allocation in a frame spent wholly in GAME_STATE.
+    bool zeroAlloc = false;
+    // Chrome trace-event JSON of frames, loads and state changes.
+    std::string tracePath;
+    // CSV of gameplay events, written by an EventBus consumer thread.
+    std::string telemetryPath;
+
+    static GameOptions parse(int argc, char** argv);
+    static const char* usage();
+};
+
+class OptionsException : public std::runtime_error {
+public:
+    explicit OptionsException(const std::string& message) : std::runtime_error(message) {}
+};
+
+#endif // OPTIONS_H
\ No newline at end of file
@@ -1,287 +1,533 @@
 #include "platformer.h"
+#include "simulation.h"
 #include "level.h"
-#include "player.h"
-#include "enemy.h"
+#include "replay.h"
+#include "snapshot.h"
+#include "rewind_buffer.h"
 #include "graphics.h"
+#include "asset_archive.h"
+#include "options.h"
+#include "profiler.h"
+#include "input_script.h"
+#include "benchmark_report.h"
+#include "arena.h"
+#include "trace.h"
+#include "memory_report.h"
+#include "sound_pool.h"
+#include "event_bus.h"
+#include "telemetry_recorder.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
 
-Game::Game() : gameState(MENU_STATE), gameFrame(0), levelIndex(0), transitionTimer(0) {
-    SetConfigFlags(FLAG_VSYNC_HINT);
-    InitWindow(1024, 480, "Platformer");
-    SetWindowSize(1024, 480);
-    SetTargetFPS(60);
-    HideCursor();
+const char* const Game::BENCHMARK_ROUTE_PATH = "data/benchmark.rep";
 
-    currentLevel = new Level();
-    player = new Player();
-    graphics = new Graphics(player);
+Game::Game(const GameOptions& options)
+    : rewindHeld(false), quitRequested(false), profilerVisible(false), memoryVisible(false), zeroAlloc(options.zeroAlloc),
+      replay(nullptr), recorder(nullptr),
+      quickSave(nullptr), rewind(nullptr), profiler(new Profiler()), tracer(nullptr),
+      memoryReport(new MemoryReport()), benchmarkFrames(options.benchmarkFrames),
+      benchmarkReportPath(options.benchmarkReportPath), headless(options.headless), script(nullptr),
+      benchmark(nullptr), simulation(nullptr), graphics(nullptr), assets(nullptr), sounds(nullptr),
+      audioTick(0), eventBus(new EventBus()), telemetry(nullptr) {
+    Profiler::setActive(profiler);
+    if (!options.tracePath.empty()) {
+        tracer = new Tracer();
+        if (tracer->open(options.tracePath)) {
+            Tracer::setActive(tracer);
+        } else {
+            TraceLog(LOG_WARNING, "TRACE: Could not create %s, tracing is off", options.tracePath.c_str());
+        }
+    }
+
+    uint64_t seed = options.seed;
+    if (!options.replayPath.empty()) {
+        Replay loaded;
+        loaded.load(options.replayPath);
+        if (loaded.getLevelPackHash() != Level::hashPack()) {
+            TraceLog(LOG_WARNING, "REPLAY: %s was recorded against a different level pack, playback will diverge",
+                     options.replayPath.c_str());
+        }
+        seed = loaded.getSeed();
+        replay = new Replay(loaded);
+    } else if (!options.hasSeed) {
+        std::random_device device;
+        seed = (static_cast<uint64_t>(device()) << 32) | device();
+    }
+
+    simulation = new Simulation(seed);
+    if (benchmarkFrames > 0) {
+        benchmark = new BenchmarkReport(benchmarkFrames);
+        if (!replay) {
+            simulation->selectLevel(options.benchmarkLevel);
+            Replay route;
+            try {
+                route.load(BENCHMARK_ROUTE_PATH);
+                script = new InputScript(&route);
+            } catch (const ReplayException& e) {
+                TraceLog(LOG_WARNING, "BENCHMARK: %s, the scripted player will not clear levels", e.what());
+                script = new InputScript();
+            }
+        }
+    }
+
+    if (!headless) {
+        // Benchmarks run uncapped.
+        if (benchmarkFrames == 0) SetConfigFlags(FLAG_VSYNC_HINT);
+        InitWindow(1024, 480, "Platformer");
+        SetWindowSize(1024, 480);
+        HideCursor();
+
+        assets = new AssetArchive();
+        if (!assets->open(AssetArchive::DEFAULT_PATH)) {
+            TraceLog(LOG_WARNING, "ASSETS: %s not found, loading assets from individual files", AssetArchive::DEFAULT_PATH);
+        }
+        graphics = new Graphics(simulation->getPlayer(), assets, options, seed);
+    }
+
+    if (!options.recordPath.empty()) {
+        recorder = new Replay();
+        recorder->reset(seed, Level::hashPack());
+        recordPath = options.recordPath;
+    }
+    // Rewinding rewrites history, so it is only offered in free play.
+    if (!replay && !recorder) {
+        rewind = new RewindBuffer(RewindBuffer::DEFAULT_SECONDS * TICKS_PER_SECOND);
+    }
+    TraceLog(LOG_INFO, "Run seed: %llu", static_cast<unsigned long long>(seed));
+
+    if (!headless) {
+        loadAssets();
+    } else {
+        sounds = new SoundPool(SoundPool::NULL_BACKEND);
+    }
 
-    loadAssets();
-    currentLevel->load(levelIndex);
-    player->spawn(currentLevel);
+    eventBus->subscribe("audio", [this](const GameEvent& event) { playEventSound(event); },
+                        [this] { sounds->update(audioTick); });
+    if (!options.telemetryPath.empty()) {
+        telemetry = new TelemetryRecorder();
+        if (telemetry->open(options.telemetryPath)) {
+            eventBus->subscribe("telemetry", [this](const GameEvent& event) { telemetry->record(event); },
+                                [this] { telemetry->flush(); });
+        } else {
+            TraceLog(LOG_WARNING, "TELEMETRY: Could not create %s, telemetry is off", options.telemetryPath.c_str());
+            delete telemetry;
+            telemetry = nullptr;
+        }
+    }
+    eventBus->start();
 }
 
 Game::~Game() {
-    unloadAssets();
-    delete currentLevel;
-    delete player;
-    delete graphics;
-    for (auto enemy : enemies) {
-        delete enemy;
-    }
-    CloseAudioDevice();
-    CloseWindow();
+    eventBus->stop();
+    for (size_t i = 0; i < eventBus->getConsumerCount(); i++) {
+        if (eventBus->getDroppedCount(i) > 0) {
+            TraceLog(LOG_WARNING, "EVENTS: Consumer '%s' fell behind and dropped %llu events", eventBus->getConsumerName(i),
+                     static_cast<unsigned long long>(eventBus->getDroppedCount(i)));
+        }
+    }
+    delete eventBus;
+    if (telemetry) {
+        TraceLog(LOG_INFO, "TELEMETRY: Recorded %llu events (%llu coins, %llu enemies killed, %llu deaths)",
+                 static_cast<unsigned long long>(telemetry->getTotal()),
+                 static_cast<unsigned long long>(telemetry->getCount(GameEvent::COIN_COLLECTED)),
+                 static_cast<unsigned long long>(telemetry->getCount(GameEvent::ENEMY_KILLED)),
+                 static_cast<unsigned long long>(telemetry->getDeathCount()));
+        delete telemetry;
+    }
+
+    if (recorder) {
+        try {
+            recorder->setEndState(Replay::endStateOf(*simulation));
+            recorder->save(recordPath);
+            TraceLog(LOG_INFO, "REPLAY: Recorded %llu ticks to %s",
+                     static_cast<unsigned long long>(recorder->getTickCount()), recordPath.c_str());
+        } catch (const ReplayException& e) {
+            TraceLog(LOG_ERROR, "REPLAY: %s", e.what());
+        }
+        delete recorder;
+    }
+    delete replay;
+    delete quickSave;
+    delete rewind;
+    delete script;
+    delete benchmark;
+    delete memoryReport;
+    Profiler::setActive(nullptr);
+    delete profiler;
+
+    delete simulation;
+    delete sounds;
+    if (!headless) {
+        delete graphics;
+        delete assets;
+        CloseAudioDevice();
+        CloseWindow();
+    }
+
+    if (tracer) {
+        Tracer::setActive(nullptr);
+        if (tracer->isOpen()) {
+            tracer->close();
+            TraceLog(LOG_INFO, "TRACE: Wrote %llu events", static_cast<unsigned long long>(tracer->getEventCount()));
+        }
+        delete tracer;
+    }
 }
 
 void Game::loadAssets() {
-    menuFont = LoadFontEx("data/fonts/ARCADE_N.TTF", 256, nullptr, 128);
     InitAudioDevice();
     if (!IsAudioDeviceReady()) {
         TraceLog(LOG_WARNING, "Audio device initialization failed. Proceeding without sound.");
-    } else {
-        coinSound = LoadSound("data/sounds/coin.wav");
-        exitSound = LoadSound("data/sounds/exit.wav");
-        killEnemySound = LoadSound("data/sounds/kill_enemy.wav");
-        playerDeathSound = LoadSound("data/sounds/player_death.wav");
-        gameOverSound = LoadSound("data/sounds/game_over.wav");
+        sounds = new SoundPool(SoundPool::NULL_BACKEND);
+        return;
     }
-}
 
-void Game::unloadAssets() {
-    UnloadFont(menuFont);
-    if (IsAudioDeviceReady()) {
-        UnloadSound(coinSound);
-        UnloadSound(exitSound);
-        UnloadSound(killEnemySound);
-        UnloadSound(playerDeathSound);
-        UnloadSound(gameOverSound);
+    sounds = new SoundPool(SoundPool::RAYLIB_BACKEND);
+    for (int effect = 0; effect < SoundPool::EFFECT_COUNT; effect++) {
+        const char* name = SoundPool::getEffectName(static_cast<SoundPool::Effect>(effect));
+        sounds->load(static_cast<SoundPool::Effect>(effect), assets->loadSound(std::string("data/sounds/") + name));
     }
 }
 
-void Game::update() {
-    gameFrame++;
-    static GameState previousState = MENU_STATE;
-
-    switch (gameState) {
-        case MENU_STATE:
-            if (IsAudioDeviceReady()) StopSound(playerDeathSound);
-            if (IsKeyPressed(KEY_ENTER)) {
-                TraceLog(LOG_INFO, "Transitioning to GAME_STATE");
-                gameState = GAME_STATE;
-                currentLevel->unload();
-                currentLevel->load(levelIndex);
-                player->spawn(currentLevel);
-                for (auto enemy : enemies) delete enemy;
-                enemies.clear();
-                for (size_t row = 0; row < currentLevel->getRows(); ++row) {
-                    for (size_t column = 0; column < currentLevel->getColumns(); ++column) {
-                        if (currentLevel->getCell(row, column) == currentLevel->getEnemyChar()) {
-                            enemies.push_back(new Enemy({static_cast<float>(column), static_cast<float>(row)}));
-                            currentLevel->setCell(row, column, currentLevel->getAirChar());
-                        }
-                    }
-                }
-            }
-            if (IsKeyPressed(KEY_ESCAPE)) {
-                TraceLog(LOG_INFO, "Exiting game from MENU_STATE");
-                CloseWindow();
-            }
-            break;
+void Game::pollInput() {
+    pendingInput.right = IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D);
+    pendingInput.left = IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A);
+    pendingInput.jump = IsKeyDown(KEY_UP) || IsKeyDown(KEY_W) || IsKeyDown(KEY_SPACE);
+    pendingInput.enter = pendingInput.enter || IsKeyPressed(KEY_ENTER);
+    pendingInput.escape = pendingInput.escape || IsKeyPressed(KEY_ESCAPE);
+    rewindHeld = IsKeyDown(KEY_R);
+}
 
-        case GAME_STATE:
-            {
-                float deltaX = 0.0f;
-                if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) deltaX += 0.1f;
-                if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) deltaX -= 0.1f;
-                if (deltaX != 0.0f) player->moveHorizontally(deltaX, currentLevel);
+void Game::handleHotkeys() {
+    if (IsKeyPressed(KEY_F3)) {
+        profilerVisible = !profilerVisible;
+    }
+    if (IsKeyPressed(KEY_F4)) {
+        if (profiler->exportCsv(Profiler::DEFAULT_CSV_PATH)) {
+            TraceLog(LOG_INFO, "PROFILER: Wrote the last %llu frames to %s",
+                     static_cast<unsigned long long>(std::min<uint64_t>(profiler->getFrameCount(), Profiler::HISTORY)),
+                     Profiler::DEFAULT_CSV_PATH);
+        } else {
+            TraceLog(LOG_WARNING, "PROFILER: Could not write %s", Profiler::DEFAULT_CSV_PATH);
+        }
+    }
 
-                if ((IsKeyDown(KEY_UP) || IsKeyDown(KEY_W) || IsKeyDown(KEY_SPACE)) && player->isOnGround()) {
-                    player->jump();
-                }
+    if (IsKeyPressed(KEY_F6)) {
+        memoryVisible = !memoryVisible;
+    }
+    if (IsKeyPressed(KEY_F7)) {
+        collectMemoryReport();
+        if (memoryReport->writeFile(MemoryReport::DEFAULT_PATH)) {
+            TraceLog(LOG_INFO, "MEMORY: Wrote %zu entries (%zu bytes) to %s", memoryReport->getEntries().size(),
+                     memoryReport->getTotal(), MemoryReport::DEFAULT_PATH);
+        } else {
+            TraceLog(LOG_WARNING, "MEMORY: Could not write %s", MemoryReport::DEFAULT_PATH);
+        }
+    }
 
-                player->update(currentLevel, enemies, coinSound, exitSound, killEnemySound, playerDeathSound, gameFrame);
+    bool save = IsKeyPressed(KEY_F5);
+    bool load = IsKeyPressed(KEY_F9);
+    if (!save && !load) return;
 
-                for (auto enemy : enemies) {
-                    enemy->update(currentLevel);
-                }
+    // Restoring mid-run would desync the recorded input stream.
+    if (replay || recorder) {
+        TraceLog(LOG_WARNING, "SNAPSHOT: Quick save/load is disabled while recording or replaying");
+        return;
+    }
 
-                if (IsKeyPressed(KEY_ESCAPE)) {
-                    TraceLog(LOG_INFO, "Transitioning to PAUSED_STATE");
-                    gameState = PAUSED_STATE;
-                }
+    if (save) {
+        if (!quickSave) quickSave = new Snapshot();
+        simulation->saveState(*quickSave);
+        TraceLog(LOG_INFO, "SNAPSHOT: Saved tick %llu", static_cast<unsigned long long>(quickSave->gameFrame));
+    } else if (quickSave) {
+        simulation->restoreState(*quickSave);
+        eventBus->publish(simulation->getEvents());
+        if (rewind) rewind->clear();
+        TraceLog(LOG_INFO, "SNAPSHOT: Restored tick %llu", static_cast<unsigned long long>(quickSave->gameFrame));
+    }
+}
 
-                if (currentLevel->isColliding(player->getPosition(), currentLevel->getExitChar())) {
-                    TraceLog(LOG_INFO, "Level completed, transitioning to next level");
-                    if (IsAudioDeviceReady()) PlaySound(exitSound);
-                    gameState = LEVEL_TRANSITION_STATE;
-                }
+void Game::collectMemoryReport() {
+    memoryReport->clear();
+    simulation->reportMemory(*memoryReport);
+    if (graphics) graphics->reportMemory(*memoryReport);
 
-                if (player->isDead()) {
-                    TraceLog(LOG_INFO, "Transitioning to DEATH_STATE");
-                    gameState = DEATH_STATE;
-                }
-            }
-            break;
+    sounds->reportMemory(*memoryReport);
 
-        case PAUSED_STATE:
-            if (IsKeyPressed(KEY_ESCAPE)) {
-                TraceLog(LOG_INFO, "Returning to GAME_STATE");
-                gameState = GAME_STATE;
-            }
-            break;
+    if (rewind) memoryReport->add("diagnostics", "rewind buffer", rewind->getMemoryUsage());
+    memoryReport->add("diagnostics", "profiler", profiler->getMemoryUsage());
+    if (tracer) memoryReport->add("diagnostics", "trace chunks", tracer->getMemoryUsage());
+    memoryReport->add("diagnostics", "event queues", eventBus->getMemoryUsage());
+    memoryReport->add("diagnostics", "frame arena", Arena::frame().getCapacity());
+    memoryReport->add("diagnostics", "load arena", Arena::load().getCapacity());
+    memoryReport->add("diagnostics", "memory report", memoryReport->getEntries().capacity() * sizeof(MemoryReport::Entry));
+}
 
-        case DEATH_STATE:
-            player->updateGravity(currentLevel);
-            if (IsKeyPressed(KEY_ENTER)) {
-                if (player->getLives() > 0) {
-                    TraceLog(LOG_INFO, "Restarting level in GAME_STATE");
-                    currentLevel->unload();
-                    currentLevel->load(levelIndex);
-                    player->spawn(currentLevel);
-                    for (auto enemy : enemies) delete enemy;
-                    enemies.clear();
-                    for (size_t row = 0; row < currentLevel->getRows(); ++row) {
-                        for (size_t column = 0; column < currentLevel->getColumns(); ++column) {
-                            if (currentLevel->getCell(row, column) == currentLevel->getEnemyChar()) {
-                                enemies.push_back(new Enemy({static_cast<float>(column), static_cast<float>(row)}));
-                                currentLevel->setCell(row, column, currentLevel->getAirChar());
-                            }
-                        }
-                    }
-                    gameState = GAME_STATE;
-                } else {
-                    TraceLog(LOG_INFO, "Transitioning to GAME_OVER_STATE");
-                    currentLevel->unload();
-                    gameState = GAME_OVER_STATE;
-                    if (IsAudioDeviceReady()) PlaySound(gameOverSound);
+void Game::handleEvents() {
+    for (const GameEvent& event : simulation->getEvents()) {
+        switch (event.type) {
+            case GameEvent::STATE_CHANGED:
+            {
+                auto previousState = static_cast<Simulation::GameState>(event.previousState);
+                auto state = static_cast<Simulation::GameState>(event.state);
+                TraceLog(LOG_INFO, "Transitioning from %s to %s (level %d)",
+                         Simulation::getStateName(previousState), Simulation::getStateName(state),
+                         simulation->getLevelIndex());
+                if (Tracer* active = Tracer::active()) {
+                    char detail[Tracer::DETAIL_LENGTH];
+                    std::snprintf(detail, sizeof(detail), "%s -> %s (level %d)", Simulation::getStateName(previousState),
+                                  Simulation::getStateName(state), simulation->getLevelIndex() + 1);
+                    active->instant("state change", "state", detail);
                 }
-                if (IsAudioDeviceReady()) StopSound(playerDeathSound);
+                break;
             }
-            if (IsKeyPressed(KEY_ESCAPE)) {
-                TraceLog(LOG_INFO, "Returning to MENU_STATE from DEATH_STATE");
-                currentLevel->unload();
-                gameState = MENU_STATE;
-                if (IsAudioDeviceReady()) StopSound(playerDeathSound);
-            }
-            break;
+            case GameEvent::QUIT_REQUESTED:
+                TraceLog(LOG_INFO, "Exiting game from MENU_STATE");
+                quitRequested = true;
+                break;
+            default:
+                break;
+        }
+    }
+    eventBus->publish(simulation->getEvents());
+}
 
-        case GAME_OVER_STATE:
-            if (IsKeyPressed(KEY_ENTER)) {
-                TraceLog(LOG_INFO, "Restarting game from GAME_OVER_STATE");
-                levelIndex = 0;
-                player->resetStats();
-                currentLevel->unload();
-                currentLevel->load(0);
-                player->spawn(currentLevel);
-                for (auto enemy : enemies) delete enemy;
-                enemies.clear();
-                for (size_t row = 0; row < currentLevel->getRows(); ++row) {
-                    for (size_t column = 0; column < currentLevel->getColumns(); ++column) {
-                        if (currentLevel->getCell(row, column) == currentLevel->getEnemyChar()) {
-                            enemies.push_back(new Enemy({static_cast<float>(column), static_cast<float>(row)}));
-                            currentLevel->setCell(row, column, currentLevel->getAirChar());
-                        }
-                    }
-                }
-                gameState = GAME_STATE;
+void Game::playEventSound(const GameEvent& event) {
+    // Runs on the audio consumer thread. A new tick starts whatever the
+    // previous one requested.
+    if (event.frame != audioTick) {
+        sounds->update(audioTick);
+        audioTick = event.frame;
+    }
+
+    switch (event.type) {
+        case GameEvent::COIN_COLLECTED:
+            sounds->play(SoundPool::COIN);
+            break;
+        case GameEvent::ENEMY_KILLED:
+            sounds->play(SoundPool::KILL_ENEMY);
+            break;
+        case GameEvent::PLAYER_DIED:
+            sounds->play(SoundPool::PLAYER_DEATH);
+            break;
+        case GameEvent::EXIT_TOUCHED:
+            // Fires every tick the player stands on the exit; the jingle
+            // plays once, on entering LEVEL_TRANSITION_STATE below.
+            break;
+        case GameEvent::STATE_CHANGED:
+            if (event.previousState == Simulation::DEATH_STATE || event.state == Simulation::MENU_STATE) {
+                sounds->stop(SoundPool::PLAYER_DEATH);
             }
-            if (IsKeyPressed(KEY_ESCAPE)) {
-                TraceLog(LOG_INFO, "Returning to MENU_STATE from GAME_OVER_STATE");
-                currentLevel->unload();
-                gameState = MENU_STATE;
+            if (event.state == Simulation::LEVEL_TRANSITION_STATE) {
+                sounds->play(SoundPool::EXIT);
+            } else if (event.state == Simulation::GAME_OVER_STATE) {
+                sounds->play(SoundPool::GAME_OVER);
             }
             break;
+        case GameEvent::STATE_RESTORED:
+            // Quick load or rewind; a death cry from the abandoned timeline
+            // should not keep playing.
+            sounds->stop(SoundPool::PLAYER_DEATH);
+            break;
+        case GameEvent::QUIT_REQUESTED:
+            break;
+    }
+}
 
-        case LEVEL_TRANSITION_STATE:
-            {
-                float deltaX = 0.0f;
-                if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) deltaX += 0.1f;
-                if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) deltaX -= 0.1f;
-                if (deltaX != 0.0f) player->moveHorizontally(deltaX, currentLevel);
-
-                if ((IsKeyDown(KEY_UP) || IsKeyDown(KEY_W) || IsKeyDown(KEY_SPACE)) && player->isOnGround()) {
-                    player->jump();
-                }
-
-                player->update(currentLevel, enemies, coinSound, exitSound, killEnemySound, playerDeathSound, gameFrame);
+void Game::update() {
+    if (rewind && rewindHeld) {
+        // Presses made while rewinding are dropped rather than replayed later.
+        pendingInput.clearPresses();
+        if (rewind->pop(*simulation)) {
+            eventBus->publish(simulation->getEvents());
+        }
+        return;
+    }
 
-                for (auto enemy : enemies) {
-                    enemy->update(currentLevel);
-                }
+    InputFrame input = script ? script->next(*simulation) : pendingInput;
+    pendingInput.clearPresses();
 
-                if (!currentLevel->isColliding(player->getPosition(), currentLevel->getExitChar())) {
-                    gameState = GAME_STATE;
-                } else if (player->getTimer() <= 0) {
-                    levelIndex++;
-                    if (levelIndex >= LEVEL_COUNT) {
-                        levelIndex = 0;
-                        player->resetStats();
-                        currentLevel->unload();
-                        gameState = MENU_STATE;
-                        TraceLog(LOG_INFO, "All levels completed! Returning to MENU_STATE");
-                    } else {
-                        TraceLog(LOG_INFO, "Loading next level: %d", levelIndex);
-                        currentLevel->unload();
-                        currentLevel->load(levelIndex);
-                        player->spawn(currentLevel);
-                        player->updateTimer(MAX_LEVEL_TIME - player->getTimer());
-                        for (auto enemy : enemies) {
-                            delete enemy;
-                        }
-                        enemies.clear();
-                        for (size_t row = 0; row < currentLevel->getRows(); ++row) {
-                            for (size_t column = 0; column < currentLevel->getColumns(); ++column) {
-                                if (currentLevel->getCell(row, column) == currentLevel->getEnemyChar()) {
-                                    enemies.push_back(new Enemy({static_cast<float>(column), static_cast<float>(row)}));
-                                    currentLevel->setCell(row, column, currentLevel->getAirChar());
-                                }
-                            }
-                        }
-                        gameState = GAME_STATE;
-                    }
-                }
-            }
-            break;
+    if (replay && !replay->next(input)) {
+        if (!quitRequested) {
+            TraceLog(LOG_INFO, "REPLAY: Finished after %llu ticks",
+                     static_cast<unsigned long long>(replay->getTickCount()));
+        }
+        quitRequested = true;
+        return;
+    }
+    if (recorder) {
+        recorder->record(input);
     }
 
-    previousState = gameState;
+    simulation->step(input);
+    handleEvents();
+    if (rewind) {
+        rewind->push(*simulation);
+    }
 }
 
-void Game::draw() {
-    BeginDrawing();
+void Game::draw(float alpha) {
+    if (!graphics) return;
+    graphics->beginFrame();
 
-    switch(gameState) {
-        case MENU_STATE:
+    Level* level = simulation->getLevel();
+    const std::vector<Enemy*>& enemies = simulation->getEnemies();
+    size_t gameFrame = simulation->getGameFrame();
+
+    switch (simulation->getState()) {
+        case Simulation::MENU_STATE:
             graphics->drawMenu();
             break;
-        case GAME_STATE:
-            graphics->drawGame(currentLevel, enemies, gameFrame);
+        case Simulation::GAME_STATE:
+            graphics->drawGame(level, enemies, gameFrame, alpha);
             break;
-        case DEATH_STATE:
-            graphics->drawDeathScreen(currentLevel, enemies, gameFrame);
+        case Simulation::DEATH_STATE:
+            graphics->drawDeathScreen(level, enemies, gameFrame, alpha);
             break;
-        case GAME_OVER_STATE:
+        case Simulation::GAME_OVER_STATE:
             graphics->drawGameOverMenu();
             break;
-        case PAUSED_STATE:
+        case Simulation::PAUSED_STATE:
             graphics->drawPauseMenu();
             break;
-        case LEVEL_TRANSITION_STATE:
-            graphics->drawGame(currentLevel, enemies, gameFrame);
+        case Simulation::LEVEL_TRANSITION_STATE:
+            graphics->drawGame(level, enemies, gameFrame, alpha);
             break;
     }
 
-    EndDrawing();
+    if (profilerVisible) {
+        graphics->drawProfilerOverlay(*profiler);
+    }
+    if (memoryVisible) {
+        collectMemoryReport();
+        graphics->drawMemoryOverlay(*memoryReport);
+    }
+    graphics->endFrame();
+    // Everything formatted for this frame has been drawn.
+    Arena::frame().reset();
 }
 
 void Game::run() {
-    while (!WindowShouldClose()) {
-        update();
-        draw();
+    if (benchmark) {
+        runBenchmark();
+        return;
+    }
+
+    // Fixed-timestep simulation: frames feed real time into the accumulator
+    // and the simulation consumes it in whole ticks, so game speed no longer
+    // depends on the display refresh rate or on slow frames.
+    double accumulator = 0.0;
+    while (!quitRequested && !WindowShouldClose()) {
+        TRACE_SCOPE("frame", "frame");
+        Simulation::GameState state = simulation->getState();
+        profiler->beginFrame();
+        accumulator += std::min(static_cast<double>(GetFrameTime()), MAX_FRAME_TIME);
+        {
+            PROFILE_SCOPE(INPUT);
+            pollInput();
+            handleHotkeys();
+        }
+        {
+            PROFILE_SCOPE(SIMULATION);
+            while (accumulator >= TICK_DURATION) {
+                TRACE_SCOPE("update", "frame");
+                update();
+                accumulator -= TICK_DURATION;
+            }
+        }
+        {
+            TRACE_SCOPE("draw", "frame");
+            draw(static_cast<float>(accumulator / TICK_DURATION));
+        }
+        profiler->endFrame();
+        if (zeroAlloc) checkZeroAlloc(state);
     }
 }
 
-int main() {
-    Game game;
-    game.run();
+void Game::runBenchmark() {
+    // One tick per frame and no frame cap, so every run of the same options
+    // does the same work and the frame time is the cost of the whole loop.
+    for (uint64_t frame = 0; frame < benchmarkFrames && !quitRequested; frame++) {
+        if (!headless && WindowShouldClose()) break;
+
+        TRACE_SCOPE("frame", "frame");
+        Simulation::GameState state = simulation->getState();
+        auto start = std::chrono::steady_clock::now();
+
+        profiler->beginFrame();
+        {
+            PROFILE_SCOPE(SIMULATION);
+            TRACE_SCOPE("update", "frame");
+            update();
+        }
+        {
+            TRACE_SCOPE("draw", "frame");
+            draw(1.0f);
+        }
+        profiler->endFrame();
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Profiler::Allocations allocations = profiler->getFrameAllocationTotal();
+        benchmark->addFrame(seconds, state, allocations.count, allocations.bytes);
+        if (zeroAlloc) checkZeroAlloc(state);
+    }
+
+    benchmark->print(stdout);
+    for (int phase = 0; phase < Profiler::PHASE_COUNT; phase++) {
+        const Profiler::Allocations& allocations = profiler->getTotalAllocations(static_cast<Profiler::Phase>(phase));
+        if (allocations.count == 0) continue;
+        std::printf("  %-24s %8llu allocations %10llu bytes\n", Profiler::getPhaseName(static_cast<Profiler::Phase>(phase)),
+                    static_cast<unsigned long long>(allocations.count), static_cast<unsigned long long>(allocations.bytes));
+    }
+    if (script) {
+        std::printf("scripted attempts: %llu\n", static_cast<unsigned long long>(script->getAttempts()));
+    }
+    if (!benchmarkReportPath.empty() && !benchmark->writeJson(benchmarkReportPath)) {
+        TraceLog(LOG_ERROR, "BENCHMARK: Could not write %s", benchmarkReportPath.c_str());
+    }
+}
+
+void Game::checkZeroAlloc(int frameStartState) {
+    // Level loads and respawns happen on the frame that enters GAME_STATE, so
+    // only frames that start and end in it count as steady state.
+    if (frameStartState != Simulation::GAME_STATE || simulation->getState() != Simulation::GAME_STATE) return;
+    Profiler::Allocations total = profiler->getFrameAllocationTotal();
+    if (total.count == 0) return;
+
+    TraceLog(LOG_ERROR, "ZERO-ALLOC: Frame %llu allocated %llu times (%llu bytes) in GAME_STATE",
+             static_cast<unsigned long long>(profiler->getFrameCount() - 1), static_cast<unsigned long long>(total.count),
+             static_cast<unsigned long long>(total.bytes));
+    for (int phase = 0; phase < Profiler::PHASE_COUNT; phase++) {
+        const Profiler::Allocations& allocations = profiler->getFrameAllocations(static_cast<Profiler::Phase>(phase));
+        if (allocations.count == 0) continue;
+        TraceLog(LOG_ERROR, "ZERO-ALLOC:   %s: %llu (%llu bytes)", Profiler::getPhaseName(static_cast<Profiler::Phase>(phase)),
+                 static_cast<unsigned long long>(allocations.count), static_cast<unsigned long long>(allocations.bytes));
+    }
+    std::abort();
+}
+
+int main(int argc, char** argv) {
+    GameOptions options;
+    try {
+        options = GameOptions::parse(argc, argv);
+    } catch (const OptionsException& e) {
+        std::cerr << e.what() << std::endl << GameOptions::usage();
+        return 1;
+    }
+
+    try {
+        Game game(options);
+        game.run();
+    } catch (const ReplayException& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    } catch (const LevelLoadException& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
     return 0;
 }
\ No newline at end of file
@@ -2,54 +2,96 @@
 #define PLATFORMER_H
 
 #include "raylib.h"
-#include <vector>
+#include "input.h"
+#include "game_event.h"
 #include <string>
-#include <cstddef>
 
-class Level;
-class Player;
-class Enemy;
+class Simulation;
 class Graphics;
+class Replay;
+class AssetArchive;
+struct Snapshot;
+class RewindBuffer;
+class Profiler;
+class Tracer;
+class MemoryReport;
+class SoundPool;
+class EventBus;
+class TelemetryRecorder;
+class InputScript;
+class BenchmarkReport;
+struct GameOptions;
 
+// Window, audio and keyboard frontend over the headless Simulation.
 class Game {
 public:
-    enum GameState {
-        MENU_STATE,
-        GAME_STATE,
-        PAUSED_STATE,
-        DEATH_STATE,
-        GAME_OVER_STATE,
-        LEVEL_TRANSITION_STATE
-    };
-
-    Game();
+    explicit Game(const GameOptions& options);
     ~Game();
 
     void run();
     void update();
-    void draw();
+    void draw(float alpha);
+
+    // Recorded run that clears the shipped levels, used by the benchmark
+    // script; written by tools/route_bot.
+    static const char* const BENCHMARK_ROUTE_PATH;
 
 private:
+    void runBenchmark();
+    void checkZeroAlloc(int frameStartState);
+    void collectMemoryReport();
+    void pollInput();
+    void handleHotkeys();
+    void handleEvents();
+    void playEventSound(const GameEvent& event);
+
     void loadAssets();
-    void unloadAssets();
 
-    GameState gameState;
-    size_t gameFrame;
-    int levelIndex;
-    int transitionTimer;
-    static const int LEVEL_COUNT = 3;
+    static constexpr double TICK_DURATION = 1.0 / 60.0;
+    // Longest frame fed into the accumulator, so a stall does not trigger a
+    // long burst of catch-up ticks.
+    static constexpr double MAX_FRAME_TIME = 0.25;
+    InputFrame pendingInput;
+    bool rewindHeld;
+    bool quitRequested;
+    bool profilerVisible;
+    bool memoryVisible;
+    bool zeroAlloc;
+
+    Replay* replay;
+    Replay* recorder;
+    std::string recordPath;
+
+    // F5/F9 quick save slot; a bit-exact Simulation snapshot.
+    Snapshot* quickSave;
+    // Last RewindBuffer::DEFAULT_SECONDS of ticks, stepped back while R is held.
+    RewindBuffer* rewind;
+    // Frame phase timings; F3 shows the overlay, F4 writes Profiler::DEFAULT_CSV_PATH.
+    Profiler* profiler;
+    // --trace: spans for frames, loads and assets, instants for state changes.
+    Tracer* tracer;
+    // Rebuilt on demand; F6 shows the overlay, F7 writes MemoryReport::DEFAULT_PATH.
+    MemoryReport* memoryReport;
+
+    // --benchmark: scripted input, uncapped frames and a report at the end.
+    uint64_t benchmarkFrames;
+    std::string benchmarkReportPath;
+    bool headless;
+    InputScript* script;
+    BenchmarkReport* benchmark;
 
-    Level* currentLevel;
-    Player* player;
-    std::vector<Enemy*> enemies;
+    Simulation* simulation;
     Graphics* graphics;
+    AssetArchive* assets;
+    // Null backend when headless or without an audio device. Owned by the
+    // audio consumer thread once the event bus has started.
+    SoundPool* sounds;
+    uint64_t audioTick;
 
-    Font menuFont;
-    Sound coinSound;
-    Sound exitSound;
-    Sound killEnemySound;
-    Sound playerDeathSound;
-    Sound gameOverSound;
+    // Each tick's simulation events go to the audio consumer and, with
+    // --telemetry, to the telemetry recorder, each on its own thread.
+    EventBus* eventBus;
+    TelemetryRecorder* telemetry;
 };
 
 #endif // PLATFORMER_H
\ No newline at end of file
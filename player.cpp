@@ -1,9 +1,13 @@
 #include "player.h"
 #include "level.h"
 #include "enemy.h"
+#include "collision.h"
+#include <algorithm>
 #include <cmath>
 
 Player::Player() :
+    position{0.0f, 0.0f},
+    previousPosition{0.0f, 0.0f},
     yVelocity(0),
     onGround(false),
     lookingForward(true),
@@ -17,6 +21,28 @@ Player::Player() :
     }
 }
 
+Player::State Player::getState() const {
+    State state = {
+        position, previousPosition, yVelocity, onGround, lookingForward, moving, dead, lives, timer, timeToCoinCounter, {}
+    };
+    std::copy(levelScores, levelScores + LEVEL_COUNT, state.levelScores);
+    return state;
+}
+
+void Player::setState(const State& state) {
+    position = state.position;
+    previousPosition = state.previousPosition;
+    yVelocity = state.yVelocity;
+    onGround = state.onGround;
+    lookingForward = state.lookingForward;
+    moving = state.moving;
+    dead = state.dead;
+    lives = state.lives;
+    timer = state.timer;
+    timeToCoinCounter = state.timeToCoinCounter;
+    std::copy(state.levelScores, state.levelScores + LEVEL_COUNT, levelScores);
+}
+
 void Player::resetStats() {
     lives = MAX_PLAYER_LIVES;
     dead = false;
@@ -26,8 +52,11 @@ void Player::resetStats() {
     }
 }
 
-void Player::incrementScore() {
-    levelScores[level_index] += 1;
+void Player::incrementScore(int levelIndex) {
+    // Scores are only kept for the standard pack's levels; coins in the
+    // extra levels of a larger pack (level_gen --levels N) are not scored.
+    if (levelIndex < 0 || levelIndex >= LEVEL_COUNT) return;
+    levelScores[levelIndex] += 1;
 }
 
 int Player::getTotalScore() const {
@@ -44,6 +73,7 @@ void Player::spawn(Level* level) {
         for (size_t column = 0; column < level->getColumns(); ++column) {
             if (level->getCell(row, column) == PLAYER) {
                 position = {static_cast<float>(column), static_cast<float>(row)};
+                previousPosition = position;
                 yVelocity = 0;
                 onGround = false;
                 dead = false;
@@ -55,6 +85,7 @@ void Player::spawn(Level* level) {
     }
     if (!found) {
         position = {1.0f, static_cast<float>(level->getRows() - 2)};
+        previousPosition = position;
         yVelocity = 0;
         onGround = false;
         dead = false;
@@ -89,8 +120,7 @@ void Player::jump() {
     }
 }
 
-void Player::update(Level* level, std::vector<Enemy*>& enemies, Sound coinSound, Sound exitSound,
-                   Sound killEnemySound, Sound playerDeathSound, size_t gameFrame) {
+void Player::update(Level* level, std::vector<Enemy*>& enemies, std::vector<GameEvent>& events, size_t gameFrame) {
     if (dead) return;
 
     if (timer > 0) {
@@ -104,12 +134,12 @@ void Player::update(Level* level, std::vector<Enemy*>& enemies, Sound coinSound,
     if (level->isColliding(position, COIN)) {
         char& cell = level->getCollider(position, COIN);
         cell = AIR;
-        incrementScore();
-        if (IsAudioDeviceReady()) PlaySound(coinSound);
+        incrementScore(level->getIndex());
+        events.push_back({GameEvent::COIN_COLLECTED, gameFrame, position, 0, 0});
     }
 
     if (level->isColliding(position, EXIT)) {
-        if (IsAudioDeviceReady()) PlaySound(exitSound);
+        events.push_back({GameEvent::EXIT_TOUCHED, gameFrame, position, 0, 0});
     }
 
     for (auto it = enemies.begin(); it != enemies.end();) {
@@ -119,17 +149,17 @@ void Player::update(Level* level, std::vector<Enemy*>& enemies, Sound coinSound,
         Rectangle playerBox = { position.x - 0.3f, position.y - 0.3f, 0.6f, 0.6f };
         Rectangle enemyBox = { enemyPos.x - 0.3f, enemyPos.y - 0.3f, 0.6f, 0.6f };
 
-        if (CheckCollisionRecs(playerBox, enemyBox)) {
+        if (rectanglesOverlap(playerBox, enemyBox)) {
             bool playerAboveEnemy = (position.y + 0.2f) < (enemyPos.y - 0.1f);
 
             if (playerAboveEnemy && yVelocity > 0) {
                 yVelocity = -BOUNCE_OFF_ENEMY;
-                if (IsAudioDeviceReady()) PlaySound(killEnemySound);
+                events.push_back({GameEvent::ENEMY_KILLED, gameFrame, enemyPos, 0, 0});
                 delete enemy;
                 it = enemies.erase(it);
             } else {
                 kill();
-                if (IsAudioDeviceReady()) PlaySound(playerDeathSound);
+                events.push_back({GameEvent::PLAYER_DIED, gameFrame, position, 0, 0});
                 break;
             }
         } else {
@@ -139,7 +169,7 @@ void Player::update(Level* level, std::vector<Enemy*>& enemies, Sound coinSound,
 
     if (level->isColliding(position, SPIKE)) {
         kill();
-        if (IsAudioDeviceReady()) PlaySound(playerDeathSound);
+        events.push_back({GameEvent::PLAYER_DIED, gameFrame, position, 0, 0});
     }
 
     updateGravity(level);
@@ -3,6 +3,7 @@
 
 #include "raylib.h"
 #include "globals.h"
+#include "game_event.h"
 #include <vector>
 
 class Level;
@@ -10,18 +11,34 @@ class Enemy;
 
 class Player {
 public:
+    struct State {
+        Vector2 position;
+        Vector2 previousPosition;
+        float yVelocity;
+        bool onGround;
+        bool lookingForward;
+        bool moving;
+        bool dead;
+        int lives;
+        int timer;
+        int timeToCoinCounter;
+        int levelScores[LEVEL_COUNT];
+    };
+
     Player();
     ~Player() = default;
 
     void spawn(Level* level);
+    void beginTick() { previousPosition = position; }
     void kill();
     void moveHorizontally(float delta, Level* level);
     void jump();
-    void update(Level* level, std::vector<Enemy*>& enemies, Sound coinSound, Sound exitSound, Sound killEnemySound, Sound playerDeathSound, size_t gameFrame);
+    void update(Level* level, std::vector<Enemy*>& enemies, std::vector<GameEvent>& events, size_t gameFrame);
     void updateGravity(Level* level);
     void updateTimer(int delta) { timer = std::max(0, timer + delta); }
 
     Vector2 getPosition() const { return position; }
+    Vector2 getPreviousPosition() const { return previousPosition; }
     bool isOnGround() const { return onGround; }
     bool isLookingForward() const { return lookingForward; }
     bool isMoving() const { return moving; }
@@ -30,11 +47,15 @@ public:
     int getTimer() const { return timer; }
     int getTotalScore() const;
 
+    State getState() const;
+    void setState(const State& state);
+
     void resetStats();
-    void incrementScore();
+    void incrementScore(int levelIndex);
 
 private:
     Vector2 position;
+    Vector2 previousPosition;
     float yVelocity;
     bool onGround;
     bool lookingForward;
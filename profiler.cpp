@@ -0,0 +1,135 @@
+#include "profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+const char* const Profiler::DEFAULT_CSV_PATH = "profile.csv";
+
+Profiler::Profiler() : current(), currentPhase(FRAME), frameAllocations(), totalAllocations(), written(0) {
+    for (auto& frame : samples) {
+        for (auto& sample : frame) sample.store(0, std::memory_order_relaxed);
+    }
+    statsScratch.reserve(HISTORY);
+}
+
+void Profiler::beginFrame() {
+    std::fill(current, current + PHASE_COUNT, 0);
+    std::fill(frameAllocations, frameAllocations + PHASE_COUNT, Allocations{0, 0});
+    currentPhase = FRAME;
+    frameStart = std::chrono::steady_clock::now();
+}
+
+void Profiler::endFrame() {
+    auto elapsed = std::chrono::steady_clock::now() - frameStart;
+    current[FRAME] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+    uint64_t frame = written.load(std::memory_order_relaxed);
+    std::atomic<uint32_t>* slot = samples[frame % SLOTS];
+    // Pairs with the fence in copyHistory(): a reader that sees any of these
+    // stores also sees the previous frame's count, so it drops the frame this
+    // slot used to hold.
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        // Saturates at ~4.3 s, far beyond anything worth graphing.
+        uint32_t value = static_cast<uint32_t>(std::min<uint64_t>(current[phase], UINT32_MAX));
+        slot[phase].store(value, std::memory_order_relaxed);
+    }
+    written.store(frame + 1, std::memory_order_release);
+
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        totalAllocations[phase].count += frameAllocations[phase].count;
+        totalAllocations[phase].bytes += frameAllocations[phase].bytes;
+    }
+}
+
+Profiler::Allocations Profiler::getFrameAllocationTotal() const {
+    Allocations total = {0, 0};
+    for (const Allocations& allocations : frameAllocations) {
+        total.count += allocations.count;
+        total.bytes += allocations.bytes;
+    }
+    return total;
+}
+
+size_t Profiler::copyHistory(std::vector<uint32_t>& copy) const {
+    uint64_t end = written.load(std::memory_order_acquire);
+    uint64_t begin = end > HISTORY ? end - HISTORY : 0;
+    copy.resize((end - begin) * PHASE_COUNT);
+    for (uint64_t frame = begin; frame < end; frame++) {
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            copy[(frame - begin) * PHASE_COUNT + phase] = samples[frame % SLOTS][phase].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Frames the writer lapped during the copy may be torn; drop them. The
+    // fence keeps the relaxed sample loads above from moving past this
+    // re-read, which is what makes the check a seqlock.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t now = written.load(std::memory_order_relaxed);
+    uint64_t firstIntact = now > HISTORY ? now - HISTORY : 0;
+    if (firstIntact > begin) {
+        size_t torn = static_cast<size_t>(std::min(firstIntact, end) - begin);
+        copy.erase(copy.begin(), copy.begin() + torn * PHASE_COUNT);
+    }
+    return copy.size() / PHASE_COUNT;
+}
+
+Profiler::Stats Profiler::getStats(const std::vector<uint32_t>& history, Phase phase) const {
+    std::vector<uint32_t>& values = statsScratch;
+    values.clear();
+    for (size_t i = phase; i < history.size(); i += PHASE_COUNT) {
+        values.push_back(history[i]);
+    }
+    if (values.empty()) return {0.0, 0.0, 0.0};
+
+    auto percentile = [&values](double fraction) {
+        auto nth = values.begin() + static_cast<std::ptrdiff_t>(fraction * (values.size() - 1));
+        std::nth_element(values.begin(), nth, values.end());
+        return *nth / 1e6;
+    };
+    Stats stats;
+    stats.p50Ms = percentile(0.50);
+    stats.p99Ms = percentile(0.99);
+    stats.maxMs = *std::max_element(values.begin(), values.end()) / 1e6;
+    return stats;
+}
+
+bool Profiler::exportCsv(const std::string& filename) const {
+    FILE* file = std::fopen(filename.c_str(), "w");
+    if (!file) return false;
+
+    std::fprintf(file, "frame");
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        std::fprintf(file, ",%s_ms", getPhaseName(static_cast<Phase>(phase)));
+    }
+    std::fprintf(file, "\n");
+
+    std::vector<uint32_t> history;
+    size_t frames = copyHistory(history);
+    uint64_t firstFrame = getFrameCount() - frames;
+    for (size_t frame = 0; frame < frames; frame++) {
+        std::fprintf(file, "%llu", static_cast<unsigned long long>(firstFrame + frame));
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            std::fprintf(file, ",%.4f", history[frame * PHASE_COUNT + phase] / 1e6);
+        }
+        std::fprintf(file, "\n");
+    }
+    return std::fclose(file) == 0;
+}
+
+const char* Profiler::getPhaseName(Phase phase) {
+    switch (phase) {
+        case FRAME: return "frame";
+        case INPUT: return "input";
+        case SIMULATION: return "simulation";
+        case PLAYER: return "player";
+        case ENEMIES: return "enemies";
+        case COLLISION: return "collision";
+        case BACKGROUND: return "background";
+        case TILES: return "tiles";
+        case HUD: return "hud";
+        case PRESENT: return "present";
+        case PHASE_COUNT: break;
+    }
+    return "unknown";
+}
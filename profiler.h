@@ -0,0 +1,147 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Per-frame phase timings for diagnosing stutter. Scopes add their duration
+// to the current frame's slot for their phase (phases nest, so PLAYER
+// includes its COLLISION time); endFrame() publishes the frame into a fixed
+// ring of the last HISTORY frames. One thread writes, any thread may read:
+// samples are relaxed atomics and readers drop frames that were overwritten
+// while they copied, so neither side ever blocks.
+//
+// Instrumented code reaches the profiler through a thread-local pointer, so
+// headless tools and worker threads that never install one pay a single
+// branch per scope. Building with PLATFORMER_PROFILER=OFF removes the scopes.
+//
+// Heap allocations are attributed to the innermost open scope (FRAME when
+// none is open) by the allocation hook in alloc_tracker.cpp, which only the
+// game links. Unlike the timings they are read by the profiling thread only.
+class Profiler {
+public:
+    enum Phase {
+        FRAME,
+        INPUT,
+        SIMULATION,
+        PLAYER,
+        ENEMIES,
+        COLLISION,
+        BACKGROUND,
+        TILES,
+        HUD,
+        PRESENT,
+        PHASE_COUNT
+    };
+
+    struct Stats {
+        double p50Ms;
+        double p99Ms;
+        double maxMs;
+    };
+
+    struct Allocations {
+        uint64_t count;
+        uint64_t bytes;
+    };
+
+    static constexpr size_t HISTORY = 512;
+    static const char* const DEFAULT_CSV_PATH;
+
+    Profiler();
+
+    void beginFrame();
+    void endFrame();
+    void add(Phase phase, uint64_t nanoseconds) { current[phase] += nanoseconds; }
+
+    // Scope bookkeeping for allocation attribution; enter returns the phase
+    // to hand back to leave.
+    Phase enterPhase(Phase phase) {
+        Phase previous = currentPhase;
+        currentPhase = phase;
+        return previous;
+    }
+    void leavePhase(Phase previous) { currentPhase = previous; }
+    void addAllocation(size_t bytes) {
+        frameAllocations[currentPhase].count++;
+        frameAllocations[currentPhase].bytes += bytes;
+    }
+
+    // The frame in progress, or the last one after endFrame().
+    const Allocations& getFrameAllocations(Phase phase) const { return frameAllocations[phase]; }
+    Allocations getFrameAllocationTotal() const;
+    // Summed over every ended frame.
+    const Allocations& getTotalAllocations(Phase phase) const { return totalAllocations[phase]; }
+
+    // Oldest first; durations in nanoseconds, one row of PHASE_COUNT per frame.
+    size_t copyHistory(std::vector<uint32_t>& samples) const;
+    Stats getStats(const std::vector<uint32_t>& samples, Phase phase) const;
+    uint64_t getFrameCount() const { return written.load(std::memory_order_acquire); }
+    size_t getMemoryUsage() const { return sizeof(*this) + statsScratch.capacity() * sizeof(uint32_t); }
+
+    // Frame number followed by one millisecond column per phase.
+    bool exportCsv(const std::string& filename) const;
+
+    static const char* getPhaseName(Phase phase);
+
+    static Profiler* active() { return activeProfiler; }
+    static void setActive(Profiler* profiler) { activeProfiler = profiler; }
+
+private:
+    uint64_t current[PHASE_COUNT];
+    std::chrono::steady_clock::time_point frameStart;
+    Phase currentPhase;
+    Allocations frameAllocations[PHASE_COUNT];
+    Allocations totalAllocations[PHASE_COUNT];
+    // getStats() sorts in here, so drawing the overlay does not allocate.
+    mutable std::vector<uint32_t> statsScratch;
+    // One spare slot for the frame being written, so all HISTORY published
+    // frames stay readable.
+    static constexpr size_t SLOTS = HISTORY + 1;
+    std::atomic<uint32_t> samples[SLOTS][PHASE_COUNT];
+    std::atomic<uint64_t> written;
+
+    static inline thread_local Profiler* activeProfiler = nullptr;
+};
+
+// Adds the enclosing block's duration to a phase of the active profiler.
+class ProfileScope {
+public:
+    explicit ProfileScope(Profiler::Phase phase) : profiler(Profiler::active()), phase(phase), previous() {
+        if (profiler) {
+            previous = profiler->enterPhase(phase);
+            start = std::chrono::steady_clock::now();
+        }
+    }
+    ~ProfileScope() {
+        if (profiler) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            profiler->add(phase, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            profiler->leavePhase(previous);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler* profiler;
+    Profiler::Phase phase;
+    Profiler::Phase previous;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef PLATFORMER_PROFILER
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(Profiler::phase)
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#endif
+
+#endif // PROFILER_H
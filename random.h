@@ -0,0 +1,59 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// Small seeded PRNG (xorshift64*) so every subsystem owns its own stream and
+// a run can be reproduced from one seed. Replaces std::rand().
+class Random {
+public:
+    enum Stream : uint64_t {
+        SIMULATION_STREAM = 1,
+        GRAPHICS_STREAM = 2,
+        POLICY_STREAM = 3
+    };
+
+    explicit Random(uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(uint64_t seed) {
+        state = mix(seed);
+        if (state == 0) state = 0x9E3779B97F4A7C15ull;
+    }
+
+    uint64_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    // Uniform in [0, 1).
+    float nextFloat() {
+        return static_cast<float>(next() >> 40) / static_cast<float>(1ull << 24);
+    }
+
+    float nextFloat(float from, float to) {
+        return from + nextFloat() * (to - from);
+    }
+
+    uint64_t getState() const { return state; }
+    void setState(uint64_t value) { state = value; }
+
+    // Independent seed for one subsystem derived from the run seed.
+    static uint64_t derive(uint64_t seed, Stream stream) {
+        return mix(seed ^ mix(static_cast<uint64_t>(stream)));
+    }
+
+private:
+    // splitmix64 finalizer
+    static uint64_t mix(uint64_t value) {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    uint64_t state;
+};
+
+#endif // RANDOM_H
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include "replay.h"
+#include "simulation.h"
+#include "player.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const char MAGIC[4] = {'P', 'R', 'P', 'L'};
+
+void writeInteger(std::vector<unsigned char>& out, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+void writeVarint(std::vector<unsigned char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+class Reader {
+public:
+    Reader(const std::vector<unsigned char>& bytes) : bytes(bytes), position(0) {}
+
+    uint64_t readInteger(int count) {
+        if (position + count > bytes.size()) throw ReplayException("Replay file is truncated");
+        uint64_t value = 0;
+        for (int i = 0; i < count; i++) {
+            value |= static_cast<uint64_t>(bytes[position++]) << (8 * i);
+        }
+        return value;
+    }
+
+    uint64_t readVarint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint64_t byte = readInteger(1);
+            value |= (byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        throw ReplayException("Replay file has a malformed run length");
+    }
+
+private:
+    const std::vector<unsigned char>& bytes;
+    size_t position;
+};
+
+}
+
+Replay::Replay() :
+    seed(0),
+    levelPackHash(0),
+    tickCount(0),
+    endStateRecorded(false),
+    endState{0, 0, 0, 0},
+    cursorRun(0),
+    cursorOffset(0) {}
+
+void Replay::reset(uint64_t newSeed, uint64_t newLevelPackHash) {
+    seed = newSeed;
+    levelPackHash = newLevelPackHash;
+    tickCount = 0;
+    runs.clear();
+    endStateRecorded = false;
+    restart();
+}
+
+void Replay::setEndState(const EndState& state) {
+    endState = state;
+    endStateRecorded = true;
+}
+
+void Replay::record(const InputFrame& input) {
+    uint8_t mask = input.toMask();
+    if (!runs.empty() && runs.back().mask == mask && runs.back().length < UINT32_MAX) {
+        runs.back().length++;
+    } else {
+        runs.push_back({1, mask});
+    }
+    tickCount++;
+}
+
+Replay::EndState Replay::endStateOf(const Simulation& simulation) {
+    return {
+        simulation.getPlayer()->getTotalScore(),
+        simulation.getPlayer()->getLives(),
+        simulation.getLevelIndex(),
+        simulation.getGameFrame()
+    };
+}
+
+void Replay::save(const std::string& filename) const {
+    std::vector<unsigned char> bytes(MAGIC, MAGIC + sizeof(MAGIC));
+    writeInteger(bytes, VERSION, 4);
+    writeInteger(bytes, levelPackHash, 8);
+    writeInteger(bytes, seed, 8);
+    writeInteger(bytes, tickCount, 8);
+    writeInteger(bytes, runs.size(), 8);
+    for (const Run& run : runs) {
+        writeVarint(bytes, run.length);
+        bytes.push_back(run.mask);
+    }
+    bytes.push_back(endStateRecorded ? 1 : 0);
+    if (endStateRecorded) {
+        writeInteger(bytes, static_cast<uint32_t>(endState.score), 4);
+        writeInteger(bytes, static_cast<uint32_t>(endState.lives), 4);
+        writeInteger(bytes, static_cast<uint32_t>(endState.levelIndex), 4);
+        writeInteger(bytes, endState.frame, 8);
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw ReplayException("Could not open replay file for writing: " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        throw ReplayException("Could not write replay file: " + filename);
+    }
+}
+
+void Replay::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw ReplayException("Could not open replay file: " + filename);
+    }
+    std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (bytes.size() < sizeof(MAGIC) || std::memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        throw ReplayException("Not a replay file: " + filename);
+    }
+
+    Reader reader(bytes);
+    reader.readInteger(sizeof(MAGIC));
+    uint64_t version = reader.readInteger(4);
+    if (version != 1 && version != VERSION) {
+        throw ReplayException("Unsupported replay version " + std::to_string(version) + ": " + filename);
+    }
+
+    levelPackHash = reader.readInteger(8);
+    seed = reader.readInteger(8);
+    tickCount = reader.readInteger(8);
+    uint64_t runCount = reader.readInteger(8);
+
+    runs.clear();
+    uint64_t ticks = 0;
+    for (uint64_t i = 0; i < runCount; i++) {
+        uint64_t length = reader.readVarint();
+        if (length == 0 || length > UINT32_MAX) {
+            throw ReplayException("Replay file has an invalid run length: " + filename);
+        }
+        runs.push_back({static_cast<uint32_t>(length), static_cast<uint8_t>(reader.readInteger(1))});
+        ticks += length;
+    }
+    if (ticks != tickCount) {
+        throw ReplayException("Replay tick count does not match its input runs: " + filename);
+    }
+
+    // Version 1 files carry no end state.
+    endStateRecorded = version >= 2 && reader.readInteger(1) != 0;
+    if (endStateRecorded) {
+        endState.score = static_cast<int32_t>(reader.readInteger(4));
+        endState.lives = static_cast<int32_t>(reader.readInteger(4));
+        endState.levelIndex = static_cast<int32_t>(reader.readInteger(4));
+        endState.frame = reader.readInteger(8);
+    }
+
+    restart();
+}
+
+void Replay::restart() {
+    cursorRun = 0;
+    cursorOffset = 0;
+}
+
+bool Replay::next(InputFrame& input) {
+    if (isFinished()) {
+        return false;
+    }
+    input = InputFrame::fromMask(runs[cursorRun].mask);
+    if (++cursorOffset >= runs[cursorRun].length) {
+        cursorRun++;
+        cursorOffset = 0;
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "input.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+// Per-tick input stream of one run, stored as run-length encoded input
+// bitmasks together with the seed and level pack hash it was recorded
+// against. Feeding it back into a Simulation reproduces the run bit-exactly.
+class Simulation;
+
+class Replay {
+public:
+    static const uint32_t VERSION = 2;
+
+    // State the run ended in, stored so headless verification can check a
+    // replay still produces it.
+    struct EndState {
+        int score;
+        int lives;
+        int levelIndex;
+        uint64_t frame;
+
+        bool operator==(const EndState& other) const {
+            return score == other.score && lives == other.lives && levelIndex == other.levelIndex && frame == other.frame;
+        }
+        bool operator!=(const EndState& other) const { return !(*this == other); }
+    };
+
+    Replay();
+
+    void reset(uint64_t seed, uint64_t levelPackHash);
+    void record(const InputFrame& input);
+
+    void save(const std::string& filename) const;
+    void load(const std::string& filename);
+
+    bool next(InputFrame& input);
+    void restart();
+    bool isFinished() const { return cursorRun >= runs.size(); }
+
+    uint64_t getSeed() const { return seed; }
+    uint64_t getLevelPackHash() const { return levelPackHash; }
+    uint64_t getTickCount() const { return tickCount; }
+
+    void setEndState(const EndState& state);
+    bool hasEndState() const { return endStateRecorded; }
+    const EndState& getEndState() const { return endState; }
+
+    static EndState endStateOf(const Simulation& simulation);
+
+private:
+    struct Run {
+        uint32_t length;
+        uint8_t mask;
+    };
+
+    uint64_t seed;
+    uint64_t levelPackHash;
+    uint64_t tickCount;
+    std::vector<Run> runs;
+    bool endStateRecorded;
+    EndState endState;
+
+    size_t cursorRun;
+    uint32_t cursorOffset;
+};
+
+class ReplayException : public std::runtime_error {
+public:
+    explicit ReplayException(const std::string& message) : std::runtime_error(message) {}
+};
+
+#endif // REPLAY_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "rewind_buffer.h"
+#include "simulation.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+void writeVarint(std::vector<unsigned char>& out, size_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+size_t readVarint(const unsigned char*& data) {
+    size_t value = 0;
+    int shift = 0;
+    while (*data & 0x80) {
+        value |= static_cast<size_t>(*data++ & 0x7f) << shift;
+        shift += 7;
+    }
+    value |= static_cast<size_t>(*data++) << shift;
+    return value;
+}
+
+unsigned char byteAt(const std::vector<unsigned char>& bytes, size_t index) {
+    return index < bytes.size() ? bytes[index] : 0;
+}
+
+}
+
+RewindBuffer::RewindBuffer(size_t maxTicks, size_t capacityBytes)
+    : ring(capacityBytes), usedBytes(0), writeOffset(0), records(maxTicks), oldestRecord(0), recordCount(0) {
+    snapshot.cells.reserve(SCRATCH_RESERVE_BYTES / sizeof(Level::CellChange));
+    snapshot.enemies.reserve(SCRATCH_RESERVE_BYTES / sizeof(Enemy::State));
+    latest.reserve(SCRATCH_RESERVE_BYTES);
+    scratch.reserve(SCRATCH_RESERVE_BYTES);
+    encoded.reserve(SCRATCH_RESERVE_BYTES);
+}
+
+size_t RewindBuffer::getMemoryUsage() const {
+    return ring.capacity() + records.capacity() * sizeof(Record) + latest.capacity() + scratch.capacity() +
+           encoded.capacity();
+}
+
+void RewindBuffer::clear() {
+    usedBytes = 0;
+    writeOffset = 0;
+    oldestRecord = 0;
+    recordCount = 0;
+    latest.clear();
+}
+
+void RewindBuffer::push(const Simulation& simulation) {
+    simulation.saveState(snapshot);
+    snapshot.serialize(scratch);
+    if (latest.empty()) {
+        latest.swap(scratch);
+        return;
+    }
+
+    encodeDelta(latest, scratch);
+    if (records.empty() || encoded.size() > ring.size()) {
+        // Cannot be stored; restart the history from this tick.
+        clear();
+        latest.swap(scratch);
+        return;
+    }
+
+    while (recordCount == records.size() || ring.size() - usedBytes < encoded.size()) {
+        dropOldest();
+    }
+
+    Record& record = records[(oldestRecord + recordCount) % records.size()];
+    record.offset = writeOffset;
+    record.size = static_cast<uint32_t>(encoded.size());
+    record.previousLength = static_cast<uint32_t>(latest.size());
+    writeRing(writeOffset, encoded.data(), encoded.size());
+    writeOffset = (writeOffset + encoded.size()) % ring.size();
+    usedBytes += encoded.size();
+    recordCount++;
+
+    latest.swap(scratch);
+}
+
+bool RewindBuffer::pop(Simulation& simulation) {
+    if (recordCount == 0) return false;
+
+    const Record& record = records[(oldestRecord + recordCount - 1) % records.size()];
+    decodeDelta(record, latest, scratch);
+    writeOffset = record.offset;
+    usedBytes -= record.size;
+    recordCount--;
+    latest.swap(scratch);
+
+    snapshot.deserialize(latest.data(), latest.size());
+    simulation.restoreState(snapshot);
+    return true;
+}
+
+void RewindBuffer::dropOldest() {
+    usedBytes -= records[oldestRecord].size;
+    oldestRecord = (oldestRecord + 1) % records.size();
+    recordCount--;
+}
+
+// Encoding: pairs of (zero run, literal count) varints, each followed by the
+// literal XOR bytes. The shorter state is treated as zero-padded.
+void RewindBuffer::encodeDelta(const std::vector<unsigned char>& from, const std::vector<unsigned char>& to) {
+    encoded.clear();
+    size_t length = std::max(from.size(), to.size());
+    size_t i = 0;
+    while (i < length) {
+        size_t zeroStart = i;
+        while (i < length && byteAt(from, i) == byteAt(to, i)) i++;
+        size_t literalStart = i;
+        while (i < length && byteAt(from, i) != byteAt(to, i)) i++;
+        writeVarint(encoded, literalStart - zeroStart);
+        writeVarint(encoded, i - literalStart);
+        for (size_t j = literalStart; j < i; j++) {
+            encoded.push_back(byteAt(from, j) ^ byteAt(to, j));
+        }
+    }
+}
+
+void RewindBuffer::decodeDelta(const Record& record, const std::vector<unsigned char>& to,
+                               std::vector<unsigned char>& from) {
+    encoded.resize(record.size);
+    readRing(record.offset, encoded.data(), encoded.size());
+
+    size_t length = std::max<size_t>(record.previousLength, to.size());
+    from.assign(to.begin(), to.end());
+    from.resize(length, 0);
+
+    const unsigned char* data = encoded.data();
+    const unsigned char* end = data + encoded.size();
+    size_t position = 0;
+    while (data < end) {
+        position += readVarint(data);
+        size_t literals = readVarint(data);
+        for (size_t j = 0; j < literals; j++) {
+            from[position++] ^= *data++;
+        }
+    }
+    from.resize(record.previousLength);
+}
+
+void RewindBuffer::writeRing(size_t offset, const unsigned char* data, size_t size) {
+    size_t first = std::min(size, ring.size() - offset);
+    std::memcpy(ring.data() + offset, data, first);
+    std::memcpy(ring.data(), data + first, size - first);
+}
+
+void RewindBuffer::readRing(size_t offset, unsigned char* data, size_t size) const {
+    size_t first = std::min(size, ring.size() - offset);
+    std::memcpy(data, ring.data() + offset, first);
+    std::memcpy(data + first, ring.data(), size - first);
+}
\ No newline at end of file
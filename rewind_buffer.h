@@ -0,0 +1,65 @@
+#ifndef REWIND_BUFFER_H
+#define REWIND_BUFFER_H
+
+#include "snapshot.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class Simulation;
+
+// Bounded history of recent Simulation ticks for hold-to-rewind. The newest
+// tick is kept as a serialized Snapshot and every older tick as the XOR delta
+// to its successor, zero-run compressed, in a fixed-size byte ring. XOR deltas
+// are symmetric, so walking back from the newest state needs no keyframes;
+// the oldest ticks are simply dropped when the ring or tick limit is reached.
+class RewindBuffer {
+public:
+    static const size_t DEFAULT_SECONDS = 30;
+    static const size_t DEFAULT_CAPACITY_BYTES = 1024 * 1024;
+    // Scratch reserved up front; a shipped level's snapshot is well under
+    // this, so gameplay ticks never grow the buffers (see --zero-alloc).
+    static constexpr size_t SCRATCH_RESERVE_BYTES = 16 * 1024;
+
+    RewindBuffer(size_t maxTicks, size_t capacityBytes = DEFAULT_CAPACITY_BYTES);
+
+    // Records the simulation's current tick.
+    void push(const Simulation& simulation);
+    // Restores the tick before the newest one and forgets the newest.
+    // Returns false when there is nothing left to rewind to.
+    bool pop(Simulation& simulation);
+    void clear();
+
+    size_t getTickCount() const { return recordCount; }
+    size_t getUsedBytes() const { return usedBytes; }
+    size_t getMemoryUsage() const;
+
+private:
+    struct Record {
+        size_t offset;
+        uint32_t size;
+        uint32_t previousLength;
+    };
+
+    void encodeDelta(const std::vector<unsigned char>& from, const std::vector<unsigned char>& to);
+    void decodeDelta(const Record& record, const std::vector<unsigned char>& to, std::vector<unsigned char>& from);
+    void writeRing(size_t offset, const unsigned char* data, size_t size);
+    void readRing(size_t offset, unsigned char* data, size_t size) const;
+    void dropOldest();
+
+    std::vector<unsigned char> ring;
+    size_t usedBytes;
+    size_t writeOffset;
+
+    std::vector<Record> records;
+    size_t oldestRecord;
+    size_t recordCount;
+
+    // Scratch space reused every tick so recording does not allocate.
+    Snapshot snapshot;
+    std::vector<unsigned char> latest;
+    std::vector<unsigned char> scratch;
+    std::vector<unsigned char> encoded;
+};
+
+#endif // REWIND_BUFFER_H
\ No newline at end of file
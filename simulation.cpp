@@ -0,0 +1,254 @@
+#include "simulation.h"
+#include "level.h"
+#include "level_pack.h"
+#include "player.h"
+#include "enemy.h"
+#include "snapshot.h"
+#include "profiler.h"
+#include "memory_report.h"
+
+Simulation::Simulation(uint64_t seed, const LevelPack* levelPack) :
+    pack(levelPack ? levelPack : &LevelPack::standard()),
+    gameState(MENU_STATE),
+    previousState(MENU_STATE),
+    gameFrame(0),
+    levelIndex(0),
+    seed(seed),
+    random(Random::derive(seed, Random::SIMULATION_STREAM)) {
+    level = new Level();
+    player = new Player();
+
+    level->load(*pack, levelIndex);
+    player->spawn(level);
+}
+
+Simulation::~Simulation() {
+    clearEnemies();
+    delete level;
+    delete player;
+}
+
+const char* Simulation::getStateName(GameState state) {
+    switch (state) {
+        case MENU_STATE: return "MENU_STATE";
+        case GAME_STATE: return "GAME_STATE";
+        case PAUSED_STATE: return "PAUSED_STATE";
+        case DEATH_STATE: return "DEATH_STATE";
+        case GAME_OVER_STATE: return "GAME_OVER_STATE";
+        case LEVEL_TRANSITION_STATE: return "LEVEL_TRANSITION_STATE";
+    }
+    return "UNKNOWN_STATE";
+}
+
+void Simulation::emit(GameEvent::Type type) {
+    events.push_back({type, gameFrame, player->getPosition(), previousState, gameState});
+}
+
+void Simulation::clearEnemies() {
+    for (auto enemy : enemies) {
+        delete enemy;
+    }
+    enemies.clear();
+}
+
+void Simulation::spawnEnemies() {
+    clearEnemies();
+    for (size_t row = 0; row < level->getRows(); ++row) {
+        for (size_t column = 0; column < level->getColumns(); ++column) {
+            if (level->getCell(row, column) == level->getEnemyChar()) {
+                enemies.push_back(new Enemy({static_cast<float>(column), static_cast<float>(row)}));
+                level->setCell(row, column, level->getAirChar());
+            }
+        }
+    }
+}
+
+void Simulation::restartLevel() {
+    level->unload();
+    level->load(*pack, levelIndex);
+    player->spawn(level);
+    spawnEnemies();
+}
+
+void Simulation::updateGameplay(const InputFrame& input) {
+    {
+        PROFILE_SCOPE(PLAYER);
+        float deltaX = 0.0f;
+        if (input.right) deltaX += PLAYER_MOVEMENT_SPEED;
+        if (input.left) deltaX -= PLAYER_MOVEMENT_SPEED;
+        if (deltaX != 0.0f) player->moveHorizontally(deltaX, level);
+
+        if (input.jump && player->isOnGround()) {
+            player->jump();
+        }
+
+        player->update(level, enemies, events, gameFrame);
+    }
+
+    PROFILE_SCOPE(ENEMIES);
+    for (auto enemy : enemies) {
+        enemy->update(level);
+    }
+}
+
+void Simulation::selectLevel(int index) {
+    if (index < 0 || index >= LEVEL_COUNT || static_cast<size_t>(index) >= pack->getLevelCount()) {
+        throw LevelLoadException("Invalid level index");
+    }
+    levelIndex = index;
+}
+
+void Simulation::reportMemory(MemoryReport& report) const {
+    report.add("level", "grid and dirty cells", level->getMemoryUsage());
+    report.add("level", "decoded level pack", pack->getMemoryUsage());
+    report.add("entities", "enemy container", enemies.capacity() * sizeof(Enemy*));
+    report.add("entities", "enemies", enemies.size() * sizeof(Enemy));
+    report.add("entities", "player", sizeof(Player));
+    report.add("simulation", "events", events.capacity() * sizeof(GameEvent));
+}
+
+void Simulation::saveState(Snapshot& snapshot) const {
+    snapshot.gameState = gameState;
+    snapshot.previousState = previousState;
+    snapshot.gameFrame = gameFrame;
+    snapshot.levelIndex = levelIndex;
+    snapshot.randomState = random.getState();
+    snapshot.loadedLevel = level->isLoaded() ? level->getIndex() : -1;
+    level->captureChanges(snapshot.cells);
+    snapshot.player = player->getState();
+    snapshot.enemies.clear();
+    for (auto enemy : enemies) {
+        snapshot.enemies.push_back(enemy->getState());
+    }
+}
+
+void Simulation::restoreState(const Snapshot& snapshot) {
+    gameState = static_cast<GameState>(snapshot.gameState);
+    previousState = static_cast<GameState>(snapshot.previousState);
+    gameFrame = snapshot.gameFrame;
+    levelIndex = snapshot.levelIndex;
+    random.setState(snapshot.randomState);
+
+    if (snapshot.loadedLevel < 0) {
+        level->unload();
+    } else {
+        if (!level->isLoaded() || level->getIndex() != snapshot.loadedLevel) {
+            level->unload();
+            level->load(*pack, snapshot.loadedLevel);
+        }
+        level->restoreChanges(snapshot.cells);
+    }
+
+    player->setState(snapshot.player);
+
+    while (enemies.size() > snapshot.enemies.size()) {
+        delete enemies.back();
+        enemies.pop_back();
+    }
+    while (enemies.size() < snapshot.enemies.size()) {
+        enemies.push_back(new Enemy({0.0f, 0.0f}));
+    }
+    for (size_t i = 0; i < enemies.size(); i++) {
+        enemies[i]->setState(snapshot.enemies[i]);
+    }
+
+    events.clear();
+    emit(GameEvent::STATE_RESTORED);
+}
+
+void Simulation::step(const InputFrame& input) {
+    events.clear();
+    gameFrame++;
+
+    player->beginTick();
+    for (auto enemy : enemies) {
+        enemy->beginTick();
+    }
+
+    switch (gameState) {
+        case MENU_STATE:
+            if (input.enter) {
+                restartLevel();
+                gameState = GAME_STATE;
+            }
+            if (input.escape) {
+                emit(GameEvent::QUIT_REQUESTED);
+            }
+            break;
+
+        case GAME_STATE:
+            updateGameplay(input);
+
+            if (input.escape) {
+                gameState = PAUSED_STATE;
+            }
+            if (level->isColliding(player->getPosition(), level->getExitChar())) {
+                gameState = LEVEL_TRANSITION_STATE;
+            }
+            if (player->isDead()) {
+                gameState = DEATH_STATE;
+            }
+            break;
+
+        case PAUSED_STATE:
+            if (input.escape) {
+                gameState = GAME_STATE;
+            }
+            break;
+
+        case DEATH_STATE:
+            player->updateGravity(level);
+            if (input.enter) {
+                if (player->getLives() > 0) {
+                    restartLevel();
+                    gameState = GAME_STATE;
+                } else {
+                    level->unload();
+                    gameState = GAME_OVER_STATE;
+                }
+            }
+            if (input.escape) {
+                level->unload();
+                gameState = MENU_STATE;
+            }
+            break;
+
+        case GAME_OVER_STATE:
+            if (input.enter) {
+                levelIndex = 0;
+                player->resetStats();
+                restartLevel();
+                gameState = GAME_STATE;
+            }
+            if (input.escape) {
+                level->unload();
+                gameState = MENU_STATE;
+            }
+            break;
+
+        case LEVEL_TRANSITION_STATE:
+            updateGameplay(input);
+
+            if (!level->isColliding(player->getPosition(), level->getExitChar())) {
+                gameState = GAME_STATE;
+            } else if (player->getTimer() <= 0) {
+                levelIndex++;
+                if (levelIndex >= LEVEL_COUNT) {
+                    levelIndex = 0;
+                    player->resetStats();
+                    level->unload();
+                    gameState = MENU_STATE;
+                } else {
+                    restartLevel();
+                    player->updateTimer(MAX_LEVEL_TIME - player->getTimer());
+                    gameState = GAME_STATE;
+                }
+            }
+            break;
+    }
+
+    if (gameState != previousState) {
+        emit(GameEvent::STATE_CHANGED);
+        previousState = gameState;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "input.h"
+#include "game_event.h"
+#include "random.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class Level;
+class Player;
+class Enemy;
+class LevelPack;
+class MemoryReport;
+struct Snapshot;
+
+// The game rules: level, player, enemies and the state machine, advanced one
+// fixed tick at a time. Needs no window, audio device or keyboard, so it can
+// run headless for tools, tests and benchmarks.
+class Simulation {
+public:
+    enum GameState {
+        MENU_STATE,
+        GAME_STATE,
+        PAUSED_STATE,
+        DEATH_STATE,
+        GAME_OVER_STATE,
+        LEVEL_TRANSITION_STATE
+    };
+
+    // Uses LevelPack::standard() unless given a pack, which must outlive
+    // the simulation. Instances share no mutable state, so any number of
+    // them can run in parallel on different threads.
+    explicit Simulation(uint64_t seed = 0, const LevelPack* levelPack = nullptr);
+    ~Simulation();
+
+    void step(const InputFrame& input);
+
+    // Level the next start from the menu loads. Throws LevelLoadException
+    // for an index outside the pack.
+    void selectLevel(int index);
+
+    void saveState(Snapshot& snapshot) const;
+    void restoreState(const Snapshot& snapshot);
+
+    // Level grid, decoded pack, enemies and the event list.
+    void reportMemory(MemoryReport& report) const;
+
+    const std::vector<GameEvent>& getEvents() const { return events; }
+    GameState getState() const { return gameState; }
+    size_t getGameFrame() const { return gameFrame; }
+    int getLevelIndex() const { return levelIndex; }
+    uint64_t getSeed() const { return seed; }
+    Level* getLevel() const { return level; }
+    Player* getPlayer() const { return player; }
+    const std::vector<Enemy*>& getEnemies() const { return enemies; }
+
+    static const char* getStateName(GameState state);
+
+private:
+    void restartLevel();
+    void spawnEnemies();
+    void clearEnemies();
+    void updateGameplay(const InputFrame& input);
+    void emit(GameEvent::Type type);
+
+    const LevelPack* pack;
+    GameState gameState;
+    GameState previousState;
+    size_t gameFrame;
+    int levelIndex;
+    uint64_t seed;
+    // Reserved for gameplay randomness (nothing draws from it yet). It is
+    // already saved in snapshots, so adding a use later keeps rewind, quick
+    // save and replays deterministic without changing the snapshot format.
+    Random random;
+
+    Level* level;
+    Player* player;
+    std::vector<Enemy*> enemies;
+    std::vector<GameEvent> events;
+};
+
+#endif // SIMULATION_H
\ No newline at end of file
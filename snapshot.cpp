@@ -0,0 +1,139 @@
+#include "snapshot.h"
+#include <cstring>
+
+namespace {
+
+const char MAGIC[4] = {'P', 'S', 'N', 'P'};
+
+class Writer {
+public:
+    explicit Writer(std::vector<unsigned char>& bytes) : bytes(bytes) {}
+
+    template <typename T>
+    void put(const T& value) {
+        const unsigned char* raw = reinterpret_cast<const unsigned char*>(&value);
+        bytes.insert(bytes.end(), raw, raw + sizeof(T));
+    }
+
+    void putVector(Vector2 value) {
+        put(value.x);
+        put(value.y);
+    }
+
+private:
+    std::vector<unsigned char>& bytes;
+};
+
+class Reader {
+public:
+    Reader(const unsigned char* bytes, size_t size) : bytes(bytes), size(size), position(0) {}
+
+    template <typename T>
+    T get() {
+        if (position + sizeof(T) > size) throw SnapshotException("Snapshot is truncated");
+        T value;
+        std::memcpy(&value, bytes + position, sizeof(T));
+        position += sizeof(T);
+        return value;
+    }
+
+    Vector2 getVector() {
+        float x = get<float>();
+        float y = get<float>();
+        return {x, y};
+    }
+
+private:
+    const unsigned char* bytes;
+    size_t size;
+    size_t position;
+};
+
+}
+
+void Snapshot::serialize(std::vector<unsigned char>& bytes) const {
+    bytes.clear();
+    Writer writer(bytes);
+
+    for (char c : MAGIC) {
+        writer.put(c);
+    }
+    writer.put(static_cast<uint32_t>(VERSION));
+    writer.put(static_cast<int32_t>(gameState));
+    writer.put(static_cast<int32_t>(previousState));
+    writer.put(gameFrame);
+    writer.put(static_cast<int32_t>(levelIndex));
+    writer.put(randomState);
+    writer.put(static_cast<int32_t>(loadedLevel));
+
+    writer.put(static_cast<uint32_t>(cells.size()));
+    for (const auto& cell : cells) {
+        writer.put(cell.index);
+        writer.put(cell.value);
+    }
+
+    writer.putVector(player.position);
+    writer.putVector(player.previousPosition);
+    writer.put(player.yVelocity);
+    unsigned char flags = (player.onGround ? 1 : 0) | (player.lookingForward ? 2 : 0) |
+                          (player.moving ? 4 : 0) | (player.dead ? 8 : 0);
+    writer.put(flags);
+    writer.put(static_cast<int32_t>(player.lives));
+    writer.put(static_cast<int32_t>(player.timer));
+    writer.put(static_cast<int32_t>(player.timeToCoinCounter));
+    for (int score : player.levelScores) {
+        writer.put(static_cast<int32_t>(score));
+    }
+
+    writer.put(static_cast<uint32_t>(enemies.size()));
+    for (const auto& enemy : enemies) {
+        writer.putVector(enemy.position);
+        writer.putVector(enemy.previousPosition);
+        writer.put(static_cast<unsigned char>(enemy.lookingRight ? 1 : 0));
+    }
+}
+
+void Snapshot::deserialize(const unsigned char* bytes, size_t size) {
+    if (size < sizeof(MAGIC) || std::memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0) {
+        throw SnapshotException("Not a snapshot");
+    }
+    Reader reader(bytes + sizeof(MAGIC), size - sizeof(MAGIC));
+    if (reader.get<uint32_t>() != VERSION) {
+        throw SnapshotException("Unsupported snapshot version");
+    }
+
+    gameState = reader.get<int32_t>();
+    previousState = reader.get<int32_t>();
+    gameFrame = reader.get<uint64_t>();
+    levelIndex = reader.get<int32_t>();
+    randomState = reader.get<uint64_t>();
+    loadedLevel = reader.get<int32_t>();
+
+    cells.resize(reader.get<uint32_t>());
+    for (auto& cell : cells) {
+        cell.index = reader.get<uint32_t>();
+        cell.value = reader.get<char>();
+    }
+
+    player.position = reader.getVector();
+    player.previousPosition = reader.getVector();
+    player.yVelocity = reader.get<float>();
+    unsigned char flags = reader.get<unsigned char>();
+    player.onGround = (flags & 1) != 0;
+    player.lookingForward = (flags & 2) != 0;
+    player.moving = (flags & 4) != 0;
+    player.dead = (flags & 8) != 0;
+    player.lives = reader.get<int32_t>();
+    player.timer = reader.get<int32_t>();
+    player.timeToCoinCounter = reader.get<int32_t>();
+    for (int& score : player.levelScores) {
+        score = reader.get<int32_t>();
+    }
+
+    enemies.resize(reader.get<uint32_t>());
+    for (auto& enemy : enemies) {
+        enemy.position = reader.getVector();
+        enemy.previousPosition = reader.getVector();
+        enemy.lookingRight = reader.get<unsigned char>() != 0;
+    }
+}
\ No newline at end of file
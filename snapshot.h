@@ -0,0 +1,38 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "level.h"
+#include "player.h"
+#include "enemy.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+// Complete Simulation state at one tick. The level is stored as a diff against
+// its pristine layout, so taking and restoring a snapshot costs a few
+// microseconds and restoring reproduces the exact same subsequent ticks.
+struct Snapshot {
+    static const uint32_t VERSION = 1;
+
+    int gameState;
+    int previousState;
+    uint64_t gameFrame;
+    int levelIndex;
+    uint64_t randomState;
+    int loadedLevel;  // -1 when no level is loaded
+    std::vector<Level::CellChange> cells;
+    Player::State player;
+    std::vector<Enemy::State> enemies;
+
+    // Compact versioned encoding in native byte order.
+    void serialize(std::vector<unsigned char>& bytes) const;
+    void deserialize(const unsigned char* bytes, size_t size);
+};
+
+class SnapshotException : public std::runtime_error {
+public:
+    explicit SnapshotException(const std::string& message) : std::runtime_error(message) {}
+};
+
+#endif // SNAPSHOT_H
\ No newline at end of file
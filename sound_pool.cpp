@@ -0,0 +1,108 @@
+#include "sound_pool.h"
+#include "memory_report.h"
+#include <algorithm>
+
+namespace {
+
+struct EffectConfig {
+    const char* name;
+    size_t voices;
+    // Minimum ticks between two starts of the effect.
+    uint64_t cooldownTicks;
+};
+
+// Coins and stomps come in quick runs and should overlap; the one-shot
+// jingles only ever need a single voice.
+const EffectConfig EFFECTS[SoundPool::EFFECT_COUNT] = {
+    {"coin.wav", 4, 3},
+    {"exit.wav", 1, 30},
+    {"kill_enemy.wav", 2, 4},
+    {"player_death.wav", 1, 0},
+    {"game_over.wav", 1, 0},
+};
+
+}
+
+SoundPool::SoundPool(Backend backend) : backend(backend) {
+    for (Slot& slot : slots) {
+        slot = Slot{};
+    }
+}
+
+SoundPool::~SoundPool() {
+    if (backend != RAYLIB_BACKEND) return;
+    for (Slot& slot : slots) {
+        if (slot.voiceCount == 0) continue;
+        // Aliases first, they point into the source's buffer.
+        for (size_t i = 1; i < slot.voiceCount; i++) {
+            UnloadSoundAlias(slot.voices[i]);
+        }
+        UnloadSound(slot.voices[0]);
+    }
+}
+
+void SoundPool::load(Effect effect, Sound sound) {
+    if (backend != RAYLIB_BACKEND) return;
+    Slot& slot = slots[effect];
+    slot.voices[0] = sound;
+    slot.voiceCount = EFFECTS[effect].voices;
+    for (size_t i = 1; i < slot.voiceCount; i++) {
+        slot.voices[i] = LoadSoundAlias(sound);
+    }
+}
+
+void SoundPool::play(Effect effect) {
+    Slot& slot = slots[effect];
+    if (slot.requested) {
+        slot.dropped++;
+    }
+    slot.requested = true;
+}
+
+void SoundPool::stop(Effect effect) {
+    Slot& slot = slots[effect];
+    slot.requested = false;
+    if (backend != RAYLIB_BACKEND) return;
+    for (size_t i = 0; i < slot.voiceCount; i++) {
+        StopSound(slot.voices[i]);
+    }
+}
+
+void SoundPool::update(uint64_t tick) {
+    for (int effect = 0; effect < EFFECT_COUNT; effect++) {
+        Slot& slot = slots[effect];
+        if (!slot.requested) continue;
+        slot.requested = false;
+
+        // Never more than one start per tick, whatever the cooldown.
+        uint64_t cooldown = std::max<uint64_t>(EFFECTS[effect].cooldownTicks, 1);
+        if (slot.started && tick >= slot.lastStartTick && tick - slot.lastStartTick < cooldown) {
+            slot.dropped++;
+            continue;
+        }
+        slot.started = true;
+        slot.lastStartTick = tick;
+        slot.starts++;
+
+        // Round robin, so a busy pool restarts its oldest voice.
+        if (slot.voiceCount > 0) {
+            PlaySound(slot.voices[slot.nextVoice]);
+            slot.nextVoice = (slot.nextVoice + 1) % slot.voiceCount;
+        }
+    }
+}
+
+const char* SoundPool::getEffectName(Effect effect) {
+    return EFFECTS[effect].name;
+}
+
+void SoundPool::reportMemory(MemoryReport& report) const {
+    for (int effect = 0; effect < EFFECT_COUNT; effect++) {
+        const Slot& slot = slots[effect];
+        if (slot.voiceCount == 0) continue;
+        const Sound& sound = slot.voices[0];
+        report.add("sounds", EFFECTS[effect].name,
+                   static_cast<size_t>(sound.frameCount) * sound.stream.channels * sound.stream.sampleSize / 8);
+    }
+    report.add("sounds", "voice pool", sizeof(SoundPool));
+}
@@ -0,0 +1,84 @@
+#ifndef SOUND_POOL_H
+#define SOUND_POOL_H
+
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+
+class MemoryReport;
+
+// Sound effects played through a fixed set of voices per effect. Each voice
+// after the first is a raylib alias sharing the loaded sample data, so
+// overlapping plays of one effect no longer cut each other off; when every
+// voice is busy the oldest one is restarted.
+//
+// play() only marks the effect as requested. update() is called once per
+// simulation tick and starts at most one voice per effect, and only if the
+// effect's cooldown has passed, so any number of events in a tick costs at
+// most EFFECT_COUNT PlaySound calls. The pool belongs to the audio consumer
+// thread once the game's EventBus has started.
+//
+// The null backend does the same bookkeeping without touching the audio
+// device; it is used for headless runs and when the device fails to open.
+class SoundPool {
+public:
+    enum Backend {
+        NULL_BACKEND,
+        RAYLIB_BACKEND
+    };
+
+    enum Effect {
+        COIN,
+        EXIT,
+        KILL_ENEMY,
+        PLAYER_DEATH,
+        GAME_OVER,
+        EFFECT_COUNT
+    };
+
+    static constexpr size_t MAX_VOICES = 4;
+
+    explicit SoundPool(Backend backend);
+    ~SoundPool();
+
+    SoundPool(const SoundPool&) = delete;
+    SoundPool& operator=(const SoundPool&) = delete;
+
+    // Takes ownership of sound and makes the effect's extra voices. Ignored
+    // by the null backend.
+    void load(Effect effect, Sound sound);
+
+    // Requests the effect for the current tick; repeats within a tick collapse.
+    void play(Effect effect);
+    // Silences every voice of the effect and drops a pending request.
+    void stop(Effect effect);
+    // Starts the effects requested for tick. Ticks normally increase; after a
+    // rewind to an earlier tick the cooldowns start over.
+    void update(uint64_t tick);
+
+    Backend getBackend() const { return backend; }
+    // Voices started and requests dropped by dedupe or cooldown, for checks.
+    uint64_t getStartCount(Effect effect) const { return slots[effect].starts; }
+    uint64_t getDroppedCount(Effect effect) const { return slots[effect].dropped; }
+
+    static const char* getEffectName(Effect effect);
+    // Decoded sample data per effect; aliases share it.
+    void reportMemory(MemoryReport& report) const;
+
+private:
+    struct Slot {
+        Sound voices[MAX_VOICES];
+        size_t voiceCount;
+        size_t nextVoice;
+        uint64_t lastStartTick;
+        bool started;
+        bool requested;
+        uint64_t starts;
+        uint64_t dropped;
+    };
+
+    Backend backend;
+    Slot slots[EFFECT_COUNT];
+};
+
+#endif // SOUND_POOL_H
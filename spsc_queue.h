@@ -0,0 +1,48 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+
+// Bounded lock-free ring for exactly one producer thread and one consumer
+// thread. Each side only writes its own index and publishes it with a
+// release store, so push and pop are wait-free and never allocate. A full
+// queue rejects the push rather than blocking the producer.
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    SpscQueue() : head(0), tail(0) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only; false when the queue is full.
+    bool push(const T& item) {
+        size_t write = head.load(std::memory_order_relaxed);
+        if (write - tail.load(std::memory_order_acquire) == Capacity) return false;
+        items[write & (Capacity - 1)] = item;
+        head.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only; false when the queue is empty.
+    bool pop(T& item) {
+        size_t read = tail.load(std::memory_order_relaxed);
+        if (read == head.load(std::memory_order_acquire)) return false;
+        item = items[read & (Capacity - 1)];
+        tail.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    // Kept on separate cache lines so the two threads do not false-share.
+    alignas(64) std::atomic<size_t> head;
+    alignas(64) std::atomic<size_t> tail;
+    alignas(64) T items[Capacity];
+};
+
+#endif // SPSC_QUEUE_H
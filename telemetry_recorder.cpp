@@ -0,0 +1,58 @@
+#include "telemetry_recorder.h"
+#include "simulation.h"
+
+TelemetryRecorder::TelemetryRecorder() : file(nullptr), counts(), deaths(0) {}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    close();
+}
+
+bool TelemetryRecorder::open(const std::string& filename) {
+    close();
+    file = std::fopen(filename.c_str(), "w");
+    if (!file) return false;
+    std::fprintf(file, "tick,event,x,y,from,to\n");
+    return true;
+}
+
+void TelemetryRecorder::close() {
+    if (!file) return;
+    std::fclose(file);
+    file = nullptr;
+}
+
+void TelemetryRecorder::record(const GameEvent& event) {
+    counts[event.type]++;
+    if (event.type == GameEvent::STATE_CHANGED && event.state == Simulation::DEATH_STATE) deaths++;
+    if (!file) return;
+    std::fprintf(file, "%zu,%s,%.1f,%.1f", event.frame, getTypeName(event.type), event.position.x, event.position.y);
+    if (event.type == GameEvent::STATE_CHANGED) {
+        std::fprintf(file, ",%s,%s\n", Simulation::getStateName(static_cast<Simulation::GameState>(event.previousState)),
+                     Simulation::getStateName(static_cast<Simulation::GameState>(event.state)));
+    } else {
+        std::fprintf(file, ",,\n");
+    }
+}
+
+void TelemetryRecorder::flush() {
+    if (file) std::fflush(file);
+}
+
+uint64_t TelemetryRecorder::getTotal() const {
+    uint64_t total = 0;
+    for (uint64_t count : counts) total += count;
+    return total;
+}
+
+const char* TelemetryRecorder::getTypeName(GameEvent::Type type) {
+    switch (type) {
+        case GameEvent::COIN_COLLECTED: return "coin_collected";
+        case GameEvent::ENEMY_KILLED: return "enemy_killed";
+        case GameEvent::PLAYER_DIED: return "player_died";
+        case GameEvent::EXIT_TOUCHED: return "exit_touched";
+        case GameEvent::STATE_CHANGED: return "state_changed";
+        case GameEvent::QUIT_REQUESTED: return "quit_requested";
+        case GameEvent::STATE_RESTORED: return "state_restored";
+    }
+    return "unknown";
+}
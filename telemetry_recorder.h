@@ -0,0 +1,44 @@
+#ifndef TELEMETRY_RECORDER_H
+#define TELEMETRY_RECORDER_H
+
+#include "game_event.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Gameplay event log for balancing and playtest analysis: one CSV row per
+// event (tick, type, position, state change) plus per-type counts. Meant to
+// run as an EventBus consumer, so the file writes stay off the game thread.
+class TelemetryRecorder {
+public:
+    static constexpr int TYPE_COUNT = GameEvent::STATE_RESTORED + 1;
+
+    TelemetryRecorder();
+    ~TelemetryRecorder();
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    // False when the file cannot be created.
+    bool open(const std::string& filename);
+    void close();
+
+    void record(const GameEvent& event);
+    // Pushes buffered rows to the file; called after each batch.
+    void flush();
+
+    uint64_t getCount(GameEvent::Type type) const { return counts[type]; }
+    uint64_t getTotal() const;
+    // Entries into DEATH_STATE. Falling out of the level kills the player
+    // without a PLAYER_DIED event, so this is the count to balance against.
+    uint64_t getDeathCount() const { return deaths; }
+
+    static const char* getTypeName(GameEvent::Type type);
+
+private:
+    FILE* file;
+    uint64_t counts[TYPE_COUNT];
+    uint64_t deaths;
+};
+
+#endif // TELEMETRY_RECORDER_H
@@ -0,0 +1,199 @@
+// Build-time packer for data/assets.pak (see asset_archive.h).
+// Usage: asset_packer <output> [data directory]
+// Must be run from the project root so entry names match the runtime paths.
+
+#include "asset_archive.h"
+#include "font_atlas.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct FontBake {
+    std::string path;
+    int fontSize;
+    int glyphCount;
+};
+
+// Every size bucket FontAtlas may ask for.
+std::vector<FontBake> fontBakes() {
+    std::vector<FontBake> bakes;
+    for (int size = FontAtlas::MIN_BUCKET_SIZE; size <= FontAtlas::MAX_BUCKET_SIZE; size *= 2) {
+        bakes.push_back({"data/fonts/ARCADE_N.TTF", size, FontAtlas::GLYPH_COUNT});
+    }
+    return bakes;
+}
+
+const int FONT_GLYPH_PADDING = 4;
+const size_t BLOB_ALIGNMENT = 16;
+
+struct PendingEntry {
+    AssetArchive::Entry entry;
+    std::vector<unsigned char> bytes;
+};
+
+bool setName(AssetArchive::Entry& entry, const std::string& name) {
+    if (name.size() >= sizeof(entry.name)) {
+        std::cerr << "Asset name too long for archive: " << name << std::endl;
+        return false;
+    }
+    std::strncpy(entry.name, name.c_str(), sizeof(entry.name));
+    return true;
+}
+
+bool packImage(const std::string& path, std::vector<PendingEntry>& pending) {
+    Image image = LoadImage(path.c_str());
+    if (!image.data) return false;
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    PendingEntry result = {};
+    if (!setName(result.entry, path)) return false;
+    result.entry.type = AssetArchive::IMAGE_ENTRY;
+    result.entry.params[0] = static_cast<uint32_t>(image.width);
+    result.entry.params[1] = static_cast<uint32_t>(image.height);
+    result.entry.params[2] = static_cast<uint32_t>(image.format);
+
+    const unsigned char* pixels = static_cast<const unsigned char*>(image.data);
+    result.bytes.assign(pixels, pixels + GetPixelDataSize(image.width, image.height, image.format));
+    UnloadImage(image);
+
+    pending.push_back(std::move(result));
+    return true;
+}
+
+bool packFont(const FontBake& bake, std::vector<PendingEntry>& pending) {
+    int fileSize = 0;
+    unsigned char* fileData = LoadFileData(bake.path.c_str(), &fileSize);
+    if (!fileData) return false;
+
+    GlyphInfo* glyphs = LoadFontData(fileData, fileSize, bake.fontSize, nullptr, bake.glyphCount, FONT_DEFAULT);
+    UnloadFileData(fileData);
+    if (!glyphs) return false;
+
+    Rectangle* recs = nullptr;
+    Image atlas = GenImageFontAtlas(glyphs, &recs, bake.glyphCount, bake.fontSize, FONT_GLYPH_PADDING, 0);
+
+    PendingEntry result = {};
+    if (!setName(result.entry, AssetArchive::fontKey(bake.path, bake.fontSize))) return false;
+    result.entry.type = AssetArchive::FONT_ENTRY;
+    result.entry.params[0] = static_cast<uint32_t>(bake.fontSize);
+    result.entry.params[1] = static_cast<uint32_t>(bake.glyphCount);
+    result.entry.params[2] = static_cast<uint32_t>(FONT_GLYPH_PADDING);
+    result.entry.params[3] = static_cast<uint32_t>(atlas.width);
+    result.entry.params[4] = static_cast<uint32_t>(atlas.height);
+    result.entry.params[5] = static_cast<uint32_t>(atlas.format);
+
+    for (int i = 0; i < bake.glyphCount; i++) {
+        AssetArchive::GlyphRecord record = {
+            glyphs[i].value, glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX, recs[i]
+        };
+        const unsigned char* raw = reinterpret_cast<const unsigned char*>(&record);
+        result.bytes.insert(result.bytes.end(), raw, raw + sizeof(record));
+    }
+    const unsigned char* pixels = static_cast<const unsigned char*>(atlas.data);
+    result.bytes.insert(result.bytes.end(), pixels, pixels + GetPixelDataSize(atlas.width, atlas.height, atlas.format));
+
+    UnloadImage(atlas);
+    MemFree(recs);
+    UnloadFontData(glyphs, bake.glyphCount);
+
+    pending.push_back(std::move(result));
+    return true;
+}
+
+bool packWave(const std::string& path, std::vector<PendingEntry>& pending) {
+    Wave wave = LoadWave(path.c_str());
+    if (!wave.data) return false;
+
+    PendingEntry result = {};
+    if (!setName(result.entry, path)) return false;
+    result.entry.type = AssetArchive::WAVE_ENTRY;
+    result.entry.params[0] = wave.frameCount;
+    result.entry.params[1] = wave.sampleRate;
+    result.entry.params[2] = wave.sampleSize;
+    result.entry.params[3] = wave.channels;
+
+    const unsigned char* samples = static_cast<const unsigned char*>(wave.data);
+    result.bytes.assign(samples, samples + static_cast<size_t>(wave.frameCount) * wave.channels * wave.sampleSize / 8);
+    UnloadWave(wave);
+
+    pending.push_back(std::move(result));
+    return true;
+}
+
+std::vector<std::string> collectFiles(const std::string& directory, const std::string& extension) {
+    std::vector<std::string> files;
+    if (!fs::exists(directory)) return files;
+    for (const auto& item : fs::recursive_directory_iterator(directory)) {
+        if (item.is_regular_file() && item.path().extension() == extension) {
+            files.push_back(item.path().generic_string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+size_t alignUp(size_t value) {
+    return (value + BLOB_ALIGNMENT - 1) / BLOB_ALIGNMENT * BLOB_ALIGNMENT;
+}
+
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: asset_packer <output> [data directory]" << std::endl;
+        return 1;
+    }
+    std::string output = argv[1];
+    std::string dataDirectory = argc > 2 ? argv[2] : "data";
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::vector<PendingEntry> pending;
+    bool ok = true;
+    for (const auto& path : collectFiles(dataDirectory + "/images", ".png")) {
+        ok = packImage(path, pending) && ok;
+    }
+    for (const auto& bake : fontBakes()) {
+        ok = packFont(bake, pending) && ok;
+    }
+    for (const auto& path : collectFiles(dataDirectory + "/sounds", ".wav")) {
+        ok = packWave(path, pending) && ok;
+    }
+    if (!ok) {
+        std::cerr << "Failed to pack one or more assets" << std::endl;
+        return 1;
+    }
+
+    AssetArchive::Header header = {{'P', 'A', 'K', '1'}, AssetArchive::VERSION, static_cast<uint32_t>(pending.size()), 0};
+    size_t offset = alignUp(sizeof(header) + pending.size() * sizeof(AssetArchive::Entry));
+    for (auto& item : pending) {
+        item.entry.offset = offset;
+        item.entry.size = item.bytes.size();
+        offset = alignUp(offset + item.bytes.size());
+    }
+
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Could not open " << output << " for writing" << std::endl;
+        return 1;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& item : pending) {
+        file.write(reinterpret_cast<const char*>(&item.entry), sizeof(item.entry));
+    }
+    for (const auto& item : pending) {
+        file.seekp(static_cast<std::streamoff>(item.entry.offset));
+        file.write(reinterpret_cast<const char*>(item.bytes.data()), static_cast<std::streamsize>(item.bytes.size()));
+    }
+
+    std::cout << "Packed " << pending.size() << " assets into " << output << " (" << offset << " bytes)" << std::endl;
+    return 0;
+}
\ No newline at end of file
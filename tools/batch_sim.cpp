@@ -0,0 +1,278 @@
+// Runs many independent Simulation instances across all cores, each driven
+// by a seeded input policy, and reports aggregate stats: run and per-level
+// completion rate, time to exit and where players die.
+// Usage: batch_sim [--instances N] [--threads N] [--seed S] [--max-ticks N] [--policy random|runner]
+// Run from the project root so data/levels.rll resolves.
+
+#include "simulation.h"
+#include "level.h"
+#include "level_pack.h"
+#include "random.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct BatchOptions {
+    size_t instances = 1000;
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t seed = 1;
+    uint64_t maxTicks = 60 * 60 * TICKS_PER_SECOND;
+    std::string policy = "random";
+};
+
+// Scripted or random stand-in for a player. Owns its own Random stream so
+// instances stay reproducible from their seed regardless of scheduling.
+class InputPolicy {
+public:
+    InputPolicy(const std::string& kind, uint64_t seed)
+        : runner(kind == "runner"), random(Random::derive(seed, Random::POLICY_STREAM)),
+          ticksLeft(0), direction(0), jumping(false), phase(random.next() % JUMP_PERIOD) {}
+
+    InputFrame next(const Simulation& simulation) {
+        InputFrame input;
+        Simulation::GameState state = simulation.getState();
+        if (state == Simulation::MENU_STATE || state == Simulation::DEATH_STATE) {
+            input.enter = true;
+            return input;
+        }
+
+        if (runner) {
+            uint64_t frame = simulation.getGameFrame() + phase;
+            input.right = true;
+            input.jump = frame % JUMP_PERIOD < JUMP_HOLD;
+            return input;
+        }
+
+        if (ticksLeft == 0) {
+            float roll = random.nextFloat();
+            direction = roll < 0.6f ? 1 : roll < 0.8f ? -1 : 0;
+            jumping = random.nextFloat() < 0.35f;
+            ticksLeft = 8 + static_cast<int>(random.next() % 32);
+        }
+        ticksLeft--;
+        input.right = direction > 0;
+        input.left = direction < 0;
+        input.jump = jumping;
+        return input;
+    }
+
+private:
+    static const uint64_t JUMP_PERIOD = 45;
+    static const uint64_t JUMP_HOLD = 20;
+
+    bool runner;
+    Random random;
+    int ticksLeft;
+    int direction;
+    bool jumping;
+    uint64_t phase;
+};
+
+struct LevelStats {
+    uint64_t attempts = 0;
+    uint64_t completions = 0;
+    uint64_t deaths = 0;
+    std::vector<uint64_t> exitTicks;
+    std::vector<uint64_t> deathsPerCell;
+};
+
+// Accumulated per worker thread and merged once at the end, so workers share
+// nothing but the read-only level pack and the instance counter.
+struct BatchStats {
+    uint64_t instances = 0;
+    uint64_t ticks = 0;
+    uint64_t runsCleared = 0;
+    uint64_t gameOvers = 0;
+    uint64_t timeouts = 0;
+    std::vector<LevelStats> levels;
+
+    explicit BatchStats(const LevelPack& pack) : levels(LEVEL_COUNT) {
+        for (int i = 0; i < LEVEL_COUNT; i++) {
+            const LevelPack::Layout& layout = pack.getLayout(i);
+            levels[i].deathsPerCell.assign(layout.rows * layout.columns, 0);
+        }
+    }
+
+    void merge(const BatchStats& other) {
+        instances += other.instances;
+        ticks += other.ticks;
+        runsCleared += other.runsCleared;
+        gameOvers += other.gameOvers;
+        timeouts += other.timeouts;
+        for (size_t i = 0; i < levels.size(); i++) {
+            LevelStats& level = levels[i];
+            const LevelStats& source = other.levels[i];
+            level.attempts += source.attempts;
+            level.completions += source.completions;
+            level.deaths += source.deaths;
+            level.exitTicks.insert(level.exitTicks.end(), source.exitTicks.begin(), source.exitTicks.end());
+            for (size_t cell = 0; cell < level.deathsPerCell.size(); cell++) {
+                level.deathsPerCell[cell] += source.deathsPerCell[cell];
+            }
+        }
+    }
+};
+
+void runInstance(uint64_t seed, const BatchOptions& options, const LevelPack& pack, BatchStats& stats) {
+    Simulation simulation(seed, &pack);
+    InputPolicy policy(options.policy, seed);
+    uint64_t levelStart = 0;
+    bool finished = false;
+
+    while (!finished && simulation.getGameFrame() < options.maxTicks) {
+        int levelIndex = simulation.getLevelIndex();
+        simulation.step(policy.next(simulation));
+
+        for (const GameEvent& event : simulation.getEvents()) {
+            if (event.type != GameEvent::STATE_CHANGED) continue;
+            auto previous = static_cast<Simulation::GameState>(event.previousState);
+            auto state = static_cast<Simulation::GameState>(event.state);
+            bool advanced = simulation.getLevelIndex() != levelIndex;
+
+            // Counted on entering DEATH_STATE rather than from PLAYER_DIED,
+            // which is not raised for falls out of the level.
+            if (state == Simulation::DEATH_STATE) {
+                const LevelPack::Layout& layout = pack.getLayout(levelIndex);
+                size_t row = static_cast<size_t>(std::max(0.0f, std::floor(event.position.y)));
+                size_t column = static_cast<size_t>(std::max(0.0f, std::floor(event.position.x)));
+                row = std::min(row, layout.rows - 1);
+                column = std::min(column, layout.columns - 1);
+                stats.levels[levelIndex].deaths++;
+                stats.levels[levelIndex].deathsPerCell[row * layout.columns + column]++;
+            }
+            if (advanced || (previous == Simulation::LEVEL_TRANSITION_STATE && state == Simulation::MENU_STATE)) {
+                stats.levels[levelIndex].completions++;
+                stats.levels[levelIndex].exitTicks.push_back(event.frame - levelStart);
+            }
+            if (state == Simulation::GAME_STATE && previous != Simulation::PAUSED_STATE &&
+                (previous != Simulation::LEVEL_TRANSITION_STATE || advanced)) {
+                stats.levels[simulation.getLevelIndex()].attempts++;
+                levelStart = event.frame;
+            }
+            if (previous == Simulation::LEVEL_TRANSITION_STATE && state == Simulation::MENU_STATE) {
+                stats.runsCleared++;
+                finished = true;
+            } else if (state == Simulation::GAME_OVER_STATE) {
+                stats.gameOvers++;
+                finished = true;
+            }
+        }
+    }
+
+    if (!finished) stats.timeouts++;
+    stats.instances++;
+    stats.ticks += simulation.getGameFrame();
+}
+
+double percent(uint64_t part, uint64_t whole) {
+    return whole > 0 ? 100.0 * part / whole : 0.0;
+}
+
+void printReport(const BatchStats& stats, const LevelPack& pack, double seconds, size_t threads) {
+    std::printf("%llu instances on %zu thread(s), %llu ticks in %.3f s: %.0f ticks/s\n",
+                static_cast<unsigned long long>(stats.instances), threads,
+                static_cast<unsigned long long>(stats.ticks), seconds, seconds > 0.0 ? stats.ticks / seconds : 0.0);
+    std::printf("runs cleared %.1f%%, game over %.1f%%, timed out %.1f%%\n",
+                percent(stats.runsCleared, stats.instances), percent(stats.gameOvers, stats.instances),
+                percent(stats.timeouts, stats.instances));
+
+    for (int i = 0; i < LEVEL_COUNT; i++) {
+        LevelStats level = stats.levels[i];
+        std::sort(level.exitTicks.begin(), level.exitTicks.end());
+        std::printf("\nlevel %d: %llu attempts, %llu exits (%.1f%%), %llu deaths\n", i + 1,
+                    static_cast<unsigned long long>(level.attempts),
+                    static_cast<unsigned long long>(level.completions), percent(level.completions, level.attempts),
+                    static_cast<unsigned long long>(level.deaths));
+        if (!level.exitTicks.empty()) {
+            auto at = [&level](double fraction) {
+                return level.exitTicks[static_cast<size_t>(fraction * (level.exitTicks.size() - 1))] /
+                       static_cast<double>(TICKS_PER_SECOND);
+            };
+            std::printf("  time to exit: min %.2f s, median %.2f s, p90 %.2f s\n", at(0.0), at(0.5), at(0.9));
+        }
+
+        const LevelPack::Layout& layout = pack.getLayout(i);
+        std::vector<size_t> cells;
+        for (size_t cell = 0; cell < level.deathsPerCell.size(); cell++) {
+            if (level.deathsPerCell[cell] > 0) cells.push_back(cell);
+        }
+        std::sort(cells.begin(), cells.end(), [&level](size_t a, size_t b) {
+            return level.deathsPerCell[a] > level.deathsPerCell[b];
+        });
+        for (size_t j = 0; j < std::min<size_t>(cells.size(), 5); j++) {
+            size_t cell = cells[j];
+            std::printf("  deaths at row %2zu, column %3zu ('%c'): %llu\n", cell / layout.columns,
+                        cell % layout.columns, layout.cells[cell],
+                        static_cast<unsigned long long>(level.deathsPerCell[cell]));
+        }
+    }
+}
+
+bool parseOptions(int argc, char** argv, BatchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+        if (arg == "--instances") {
+            options.instances = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--threads") {
+            options.threads = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+        } else if (arg == "--seed") {
+            options.seed = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--max-ticks") {
+            options.maxTicks = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--policy") {
+            options.policy = value;
+            if (options.policy != "random" && options.policy != "runner") return false;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    BatchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: batch_sim [--instances N] [--threads N] [--seed S] [--max-ticks N] "
+                             "[--policy random|runner]\n");
+        return 2;
+    }
+
+    const LevelPack& pack = LevelPack::standard();
+    size_t threadCount = std::min(options.threads, std::max<size_t>(1, options.instances));
+    std::vector<BatchStats> threadStats(threadCount, BatchStats(pack));
+    std::atomic<size_t> nextInstance(0);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t] {
+            for (size_t i = nextInstance++; i < options.instances; i = nextInstance++) {
+                runInstance(options.seed + i, options, pack, threadStats[t]);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    BatchStats total(pack);
+    for (const auto& stats : threadStats) {
+        total.merge(stats);
+    }
+    printReport(total, pack, seconds, threadCount);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,288 @@
+// Solvability check for .rll level packs. Explores every state the player can
+// reach using the game's own Player physics (moveHorizontally, jump,
+// updateGravity and the spike check, in Simulation's order), breadth-first
+// so the first layer that touches the exit is the minimum frame count.
+// States are deduplicated by the exact bits of position, vertical velocity and
+// ground contact; each layer is expanded in parallel.
+// Enemies are not simulated: they can be stomped or avoided, so a level is
+// only rejected when its geometry alone makes the exit unreachable.
+// Usage: level_analyzer [--threads N] [--level N] <levels.rll>
+// Exits with 1 when any analyzed level has an unreachable exit.
+
+#include "level.h"
+#include "level_pack.h"
+#include "player.h"
+#include "collision.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct PhysicsState {
+    float x;
+    float y;
+    float yVelocity;
+    bool onGround;
+};
+
+// Exact bits of the state. Rounding x to the movement step collides once
+// float drift builds up over long levels (807.05 and 807.15 both round to the
+// same step), which dropped the only forward state in wide corridors.
+struct StateKey {
+    uint32_t x;
+    uint32_t y;
+    uint32_t yVelocity;
+    bool onGround;
+
+    bool operator==(const StateKey& other) const {
+        return x == other.x && y == other.y && yVelocity == other.yVelocity && onGround == other.onGround;
+    }
+};
+
+struct StateKeyHash {
+    size_t operator()(const StateKey& key) const {
+        uint64_t hash = key.x * 0x9E3779B97F4A7C15ull;
+        hash = (hash ^ (hash >> 29) ^ key.y) * 0xBF58476D1CE4E5B9ull;
+        hash = (hash ^ (hash >> 31) ^ key.yVelocity) * 0x94D049BB133111EBull;
+        return static_cast<size_t>(hash ^ (hash >> 32) ^ (key.onGround ? 1 : 0));
+    }
+};
+
+StateKey keyOf(const PhysicsState& state) {
+    StateKey key;
+    std::memcpy(&key.x, &state.x, sizeof(key.x));
+    std::memcpy(&key.y, &state.y, sizeof(key.y));
+    std::memcpy(&key.yVelocity, &state.yVelocity, sizeof(key.yVelocity));
+    key.onGround = state.onGround;
+    return key;
+}
+
+// Visited set split into independently locked shards so threads rarely
+// contend on insertion.
+class VisitedSet {
+public:
+    bool insert(const StateKey& key) {
+        Shard& shard = shards[StateKeyHash()(key) >> (sizeof(size_t) * 8 - 6)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.keys.insert(key).second;
+    }
+
+    size_t size() const {
+        size_t total = 0;
+        for (const Shard& shard : shards) total += shard.keys.size();
+        return total;
+    }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_set<StateKey, StateKeyHash> keys;
+    };
+    Shard shards[64];
+};
+
+// One worker's private copy of the level and player, stepped with the real
+// game code.
+class Stepper {
+public:
+    Stepper(const LevelPack& pack, int levelIndex) {
+        level.load(pack, levelIndex);
+        player.spawn(&level);
+        base = player.getState();
+    }
+
+    PhysicsState spawnState() const {
+        return {base.position.x, base.position.y, base.yVelocity, base.onGround};
+    }
+
+    // Returns false when the player dies during the tick.
+    bool step(const PhysicsState& from, float deltaX, bool jump, PhysicsState& to) {
+        Player::State state = base;
+        state.position = {from.x, from.y};
+        state.yVelocity = from.yVelocity;
+        state.onGround = from.onGround;
+        player.setState(state);
+
+        if (deltaX != 0.0f) player.moveHorizontally(deltaX, &level);
+        if (jump && player.isOnGround()) player.jump();
+        if (level.isColliding(player.getPosition(), SPIKE)) return false;
+        player.updateGravity(&level);
+        if (player.isDead()) return false;
+
+        Player::State result = player.getState();
+        to = {result.position.x, result.position.y, result.yVelocity, result.onGround};
+        return true;
+    }
+
+    bool touches(const PhysicsState& state, char cell) const {
+        return level.isColliding({state.x, state.y}, cell);
+    }
+
+    // Coin cells the player's box overlaps in this state.
+    void collectCoins(const PhysicsState& state, std::vector<size_t>& coins) const {
+        Rectangle box = {state.x, state.y, 1.0f, 1.0f};
+        for (int row = static_cast<int>(std::floor(state.y)) - 1; row <= static_cast<int>(std::floor(state.y)) + 1; row++) {
+            for (int column = static_cast<int>(std::floor(state.x)) - 1;
+                 column <= static_cast<int>(std::floor(state.x)) + 1; column++) {
+                if (!level.isInside(row, column) || level.getCell(row, column) != COIN) continue;
+                if (rectanglesOverlap(box, {static_cast<float>(column), static_cast<float>(row), 1.0f, 1.0f})) {
+                    coins.push_back(row * level.getColumns() + column);
+                }
+            }
+        }
+    }
+
+private:
+    Level level;
+    Player player;
+    Player::State base;
+};
+
+struct Report {
+    long exitFrame = -1;
+    size_t states = 0;
+    std::vector<size_t> coins;
+    std::vector<bool> coinReached;
+};
+
+const float MOVES[3] = {-PLAYER_MOVEMENT_SPEED, 0.0f, PLAYER_MOVEMENT_SPEED};
+
+Report analyze(const LevelPack& pack, int levelIndex, size_t threadCount) {
+    const LevelPack::Layout& layout = pack.getLayout(levelIndex);
+    Report report;
+    std::vector<int> coinSlot(layout.cells.size(), -1);
+    for (size_t cell = 0; cell < layout.cells.size(); cell++) {
+        if (layout.cells[cell] == COIN) {
+            coinSlot[cell] = static_cast<int>(report.coins.size());
+            report.coins.push_back(cell);
+        }
+    }
+    report.coinReached.assign(report.coins.size(), false);
+
+    std::vector<std::unique_ptr<Stepper>> steppers;
+    for (size_t t = 0; t < threadCount; t++) {
+        steppers.push_back(std::make_unique<Stepper>(pack, levelIndex));
+    }
+
+    VisitedSet visited;
+    std::vector<PhysicsState> frontier = {steppers[0]->spawnState()};
+    visited.insert(keyOf(frontier[0]));
+    std::vector<std::vector<PhysicsState>> next(threadCount);
+    std::vector<std::vector<size_t>> coinsFound(threadCount);
+    std::atomic<bool> exitReached(false);
+
+    auto expand = [&](size_t t, size_t begin, size_t end) {
+        Stepper& stepper = *steppers[t];
+        for (size_t i = begin; i < end; i++) {
+            const PhysicsState& state = frontier[i];
+            for (float deltaX : MOVES) {
+                for (int jump = 0; jump <= (state.onGround ? 1 : 0); jump++) {
+                    PhysicsState result;
+                    if (!stepper.step(state, deltaX, jump != 0, result)) continue;
+                    if (!visited.insert(keyOf(result))) continue;
+                    if (stepper.touches(result, EXIT)) exitReached = true;
+                    stepper.collectCoins(result, coinsFound[t]);
+                    next[t].push_back(result);
+                }
+            }
+        }
+    };
+
+    for (long frame = 1; !frontier.empty(); frame++) {
+        // Small layers are not worth the thread start-up cost.
+        size_t workers = frontier.size() < 2048 ? 1 : threadCount;
+        size_t chunk = (frontier.size() + workers - 1) / workers;
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < workers; t++) {
+            threads.emplace_back(expand, t, std::min(frontier.size(), t * chunk),
+                                 std::min(frontier.size(), (t + 1) * chunk));
+        }
+        expand(0, 0, std::min(frontier.size(), chunk));
+        for (auto& thread : threads) thread.join();
+
+        if (exitReached && report.exitFrame < 0) report.exitFrame = frame;
+
+        frontier.clear();
+        for (size_t t = 0; t < threadCount; t++) {
+            frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+            next[t].clear();
+            for (size_t cell : coinsFound[t]) report.coinReached[coinSlot[cell]] = true;
+            coinsFound[t].clear();
+        }
+    }
+
+    report.states = visited.size();
+    return report;
+}
+
+}
+
+int main(int argc, char** argv) {
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    int onlyLevel = -1;
+    std::string filename;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            threadCount = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--level" && i + 1 < argc) {
+            onlyLevel = std::atoi(argv[++i]) - 1;
+        } else if (filename.empty() && arg.rfind("--", 0) != 0) {
+            filename = arg;
+        } else {
+            filename.clear();
+            break;
+        }
+    }
+    if (filename.empty()) {
+        std::fprintf(stderr, "Usage: level_analyzer [--threads N] [--level N] <levels.rll>\n");
+        return 2;
+    }
+
+    LevelPack pack;
+    try {
+        pack = LevelPack::fromFile(filename);
+    } catch (const LevelLoadException& e) {
+        std::fprintf(stderr, "%s: %s\n", filename.c_str(), e.what());
+        return 2;
+    }
+
+    int unsolvable = 0;
+    for (int i = 0; i < static_cast<int>(pack.getLevelCount()); i++) {
+        if (onlyLevel >= 0 && i != onlyLevel) continue;
+        const LevelPack::Layout& layout = pack.getLayout(i);
+
+        auto start = std::chrono::steady_clock::now();
+        Report report = analyze(pack, i, threadCount);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        size_t reached = std::count(report.coinReached.begin(), report.coinReached.end(), true);
+        if (report.exitFrame >= 0) {
+            std::printf("PASS  level %d (%zux%zu): exit in %ld frames (%.2f s)", i + 1, layout.columns, layout.rows,
+                        report.exitFrame, report.exitFrame / static_cast<double>(TICKS_PER_SECOND));
+        } else {
+            std::printf("FAIL  level %d (%zux%zu): exit unreachable", i + 1, layout.columns, layout.rows);
+            unsolvable++;
+        }
+        std::printf(", %zu/%zu coins reachable, %zu states in %.3f s\n", reached, report.coins.size(), report.states,
+                    seconds);
+        for (size_t c = 0; c < report.coins.size(); c++) {
+            if (!report.coinReached[c]) {
+                std::printf("      unreachable coin at row %zu, column %zu\n", report.coins[c] / layout.columns,
+                            report.coins[c] % layout.columns);
+            }
+        }
+    }
+    return unsolvable == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+// Writes seeded procedural .rll packs for stress tests and scaling
+// benchmarks, and optionally measures how the engine copes with them: pack
+// load time, level memory and simulation ticks per second.
+// Usage: level_gen [--size RxC] [--walls D] [--spikes D] [--coins D] [--enemies N] [--seed S]
+//                  [--levels N] [--measure TICKS] <output.rll>
+// Sweep --size (12x72 up to 64x1000000) to chart cost against level area.
+
+#include "level_generator.h"
+#include "level.h"
+#include "level_pack.h"
+#include "simulation.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace {
+
+struct Arguments {
+    LevelGenerator::Parameters parameters;
+    size_t levels = LEVEL_COUNT;
+    uint64_t measureTicks = 0;
+    std::string output;
+};
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool parseSize(const char* text, LevelGenerator::Parameters& parameters) {
+    char* end = nullptr;
+    parameters.rows = std::strtoull(text, &end, 10);
+    if (*end != 'x') return false;
+    parameters.columns = std::strtoull(end + 1, &end, 10);
+    return *end == '\0';
+}
+
+bool parseArguments(int argc, char** argv, Arguments& args) {
+    for (int i = 1; i < argc; i++) {
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (std::strcmp(argv[i], "--size") == 0 && value) {
+            if (!parseSize(value, args.parameters)) return false;
+            i++;
+        } else if (std::strcmp(argv[i], "--walls") == 0 && value) {
+            args.parameters.wallDensity = std::strtof(value, nullptr);
+            i++;
+        } else if (std::strcmp(argv[i], "--spikes") == 0 && value) {
+            args.parameters.spikeDensity = std::strtof(value, nullptr);
+            i++;
+        } else if (std::strcmp(argv[i], "--coins") == 0 && value) {
+            args.parameters.coinDensity = std::strtof(value, nullptr);
+            i++;
+        } else if (std::strcmp(argv[i], "--enemies") == 0 && value) {
+            args.parameters.enemyCount = std::strtoull(value, nullptr, 10);
+            i++;
+        } else if (std::strcmp(argv[i], "--seed") == 0 && value) {
+            args.parameters.seed = std::strtoull(value, nullptr, 10);
+            i++;
+        } else if (std::strcmp(argv[i], "--levels") == 0 && value) {
+            args.levels = std::strtoull(value, nullptr, 10);
+            i++;
+        } else if (std::strcmp(argv[i], "--measure") == 0 && value) {
+            args.measureTicks = std::strtoull(value, nullptr, 10);
+            i++;
+        } else if (argv[i][0] != '-' && args.output.empty()) {
+            args.output = argv[i];
+        } else {
+            return false;
+        }
+    }
+    return !args.output.empty() && args.levels > 0;
+}
+
+// Runs a fresh Simulation over the pack with a hold-right-and-hop input and
+// reports the raw update rate. Only ticks that start and end in GAME_STATE
+// count as updates; the driver dies often, and every restart copies the whole
+// grid again, so those ticks are reported on their own.
+void measure(const Arguments& args) {
+    auto start = std::chrono::steady_clock::now();
+    LevelPack pack = LevelPack::fromFile(args.output);
+    double parseSeconds = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    Level level;
+    level.load(pack, 0);
+    double loadSeconds = secondsSince(start);
+    std::printf("load:   parse %.3f ms, level copy %.3f ms, %zu bytes of cells per level\n", parseSeconds * 1e3,
+                loadSeconds * 1e3, level.getRows() * level.getColumns());
+
+    Simulation simulation(args.parameters.seed, &pack);
+    uint64_t gameTicks = 0;
+    double gameSeconds = 0.0;
+    uint64_t otherTicks = 0;
+    double otherSeconds = 0.0;
+    uint64_t loads = 0;
+    double loadTickSeconds = 0.0;
+    for (uint64_t tick = 0; tick < args.measureTicks; tick++) {
+        InputFrame input;
+        Simulation::GameState state = simulation.getState();
+        input.enter = state == Simulation::MENU_STATE || state == Simulation::DEATH_STATE ||
+                      state == Simulation::GAME_OVER_STATE;
+        input.right = true;
+        input.jump = tick % 45 < 20;
+
+        start = std::chrono::steady_clock::now();
+        simulation.step(input);
+        double seconds = secondsSince(start);
+
+        Simulation::GameState next = simulation.getState();
+        if (state == Simulation::GAME_STATE && next == Simulation::GAME_STATE) {
+            gameTicks++;
+            gameSeconds += seconds;
+        } else if (state != Simulation::GAME_STATE && next == Simulation::GAME_STATE) {
+            loads++;
+            loadTickSeconds += seconds;
+        } else {
+            otherTicks++;
+            otherSeconds += seconds;
+        }
+    }
+    std::printf("update: %llu gameplay ticks in %.3f s (%.2f us/tick, %zu enemies)\n",
+                static_cast<unsigned long long>(gameTicks), gameSeconds,
+                gameTicks > 0 ? gameSeconds * 1e6 / gameTicks : 0.0, simulation.getEnemies().size());
+    std::printf("loads:  %llu (re)starts in %.3f s (%.3f ms/start)\n", static_cast<unsigned long long>(loads),
+                loadTickSeconds, loads > 0 ? loadTickSeconds * 1e3 / loads : 0.0);
+    std::printf("other:  %llu death, transition and menu ticks in %.3f s\n", static_cast<unsigned long long>(otherTicks),
+                otherSeconds);
+}
+
+}
+
+int main(int argc, char** argv) {
+    Arguments args;
+    if (!parseArguments(argc, argv, args)) {
+        std::fprintf(stderr, "Usage: level_gen [--size RxC] [--walls D] [--spikes D] [--coins D] [--enemies N] "
+                             "[--seed S] [--levels N] [--measure TICKS] <output.rll>\n");
+        return 2;
+    }
+
+    LevelPack pack;
+    auto start = std::chrono::steady_clock::now();
+    try {
+        for (size_t i = 0; i < args.levels; i++) {
+            LevelGenerator::Parameters parameters = args.parameters;
+            parameters.seed = args.parameters.seed + i;
+            pack.addLayout(LevelGenerator::generate(parameters));
+        }
+    } catch (const LevelLoadException& e) {
+        std::fprintf(stderr, "ERROR %s\n", e.what());
+        return 2;
+    }
+    double generateSeconds = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    std::string text = pack.toString();
+    double encodeSeconds = secondsSince(start);
+
+    std::ofstream file(args.output, std::ios::binary | std::ios::trunc);
+    if (!file.is_open() || !file.write(text.data(), static_cast<std::streamsize>(text.size()))) {
+        std::fprintf(stderr, "ERROR could not write %s\n", args.output.c_str());
+        return 1;
+    }
+    file.close();
+
+    std::printf("wrote %s: %zu level(s) of %zux%zu, %zu cells, %zu bytes RLE\n", args.output.c_str(), args.levels,
+                args.parameters.rows, args.parameters.columns,
+                args.levels * args.parameters.rows * args.parameters.columns, text.size());
+    std::printf("build:  generate %.3f ms, encode %.3f ms\n", generateSeconds * 1e3, encodeSeconds * 1e3);
+
+    if (args.measureTicks > 0) {
+        try {
+            measure(args);
+        } catch (const LevelLoadException& e) {
+            std::fprintf(stderr, "FAIL %s\n", e.what());
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#!/bin/sh
+# Profile-guided optimisation pipeline for the platformer target.
+# Usage: tools/pgo.sh [build directory]
+# Must be run from the project root, like the game itself.
+#
+# 1. Builds a plain Release game as the baseline.
+# 2. Builds an instrumented game (PLATFORMER_PGO=GENERATE) and trains it on
+#    headless scripted runs of the shipped levels (--benchmark --headless).
+# 3. Rebuilds the game from that profile (PLATFORMER_PGO=USE).
+# 4. Times both games on the same scripted run and prints the comparison.
+#
+# TRAIN_FRAMES, MEASURE_FRAMES and REPEATS override the run lengths.
+
+set -eu
+
+BUILD=${1:-build-pgo}
+TRAIN_FRAMES=${TRAIN_FRAMES:-20000}
+MEASURE_FRAMES=${MEASURE_FRAMES:-50000}
+REPEATS=${REPEATS:-5}
+LEVEL_COUNT=3
+JOBS=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 4)
+
+if [ ! -f data/levels.rll ]; then
+    echo "ERROR run tools/pgo.sh from the project root" >&2
+    exit 2
+fi
+
+BASELINE=$BUILD/release
+INSTRUMENTED=$BUILD/pgo
+PROFILE=$(pwd)/$INSTRUMENTED/profile
+
+configure() {
+    cmake -S . -B "$1" -DCMAKE_BUILD_TYPE=Release -DPLATFORMER_PGO="$2" -DPLATFORMER_PGO_DIR="$PROFILE" >/dev/null
+}
+
+build() {
+    cmake --build "$1" -j"$JOBS" --target platformer
+}
+
+echo "== Baseline Release build"
+configure "$BASELINE" OFF
+build "$BASELINE"
+
+echo "== Instrumented build"
+configure "$INSTRUMENTED" GENERATE
+build "$INSTRUMENTED"
+
+echo "== Training"
+rm -rf "$PROFILE"
+mkdir -p "$PROFILE"
+level=1
+while [ "$level" -le "$LEVEL_COUNT" ]; do
+    "$INSTRUMENTED/platformer" --benchmark "$TRAIN_FRAMES" --benchmark-level "$level" --headless >/dev/null
+    level=$((level + 1))
+done
+if ls "$PROFILE"/*.profraw >/dev/null 2>&1; then
+    llvm-profdata merge -output="$PROFILE/merged.profdata" "$PROFILE"/*.profraw
+fi
+
+echo "== Optimised build"
+configure "$INSTRUMENTED" USE
+build "$INSTRUMENTED"
+
+# Best frames per second over REPEATS runs, read from the JSON report.
+measure() {
+    best=0
+    run=0
+    while [ "$run" -lt "$REPEATS" ]; do
+        "$1" --benchmark "$MEASURE_FRAMES" --headless --benchmark-report "$BUILD/report.json" >/dev/null
+        fps=$(awk -F'[:,]' '/"frames"/ && !frames { frames = $2 } /"seconds"/ && !seconds { seconds = $2 }
+                            END { printf "%.1f", frames / seconds }' "$BUILD/report.json")
+        best=$(awk -v a="$best" -v b="$fps" 'BEGIN { print (b > a) ? b : a }')
+        run=$((run + 1))
+    done
+    echo "$best"
+}
+
+echo "== Measuring ($REPEATS runs of $MEASURE_FRAMES frames each)"
+before=$(measure "$BASELINE/platformer")
+after=$(measure "$INSTRUMENTED/platformer")
+rm -f "$BUILD/report.json"
+
+printf "release      %12s fps\n" "$before"
+printf "release+pgo  %12s fps\n" "$after"
+awk -v a="$before" -v b="$after" 'BEGIN { printf "speedup      %12.3fx\n", b / a }'
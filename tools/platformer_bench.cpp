@@ -0,0 +1,259 @@
+// Microbenchmarks for the simulation and render-preparation hot paths, run
+// headless so results can be tracked commit by commit. Each case runs in
+// timed batches until MIN_BATCH_SECONDS and reports the median of REPEATS
+// batches in nanoseconds per operation.
+// Usage: platformer_bench [--filter TEXT] [--json FILE] [--quick]
+//   --filter  only run cases whose name contains TEXT
+//   --json    also write the results as JSON to FILE
+//   --quick   shorter batches, for smoke-testing the suite
+
+#include "level.h"
+#include "level_generator.h"
+#include "level_pack.h"
+#include "player.h"
+#include "enemy.h"
+#include "game_event.h"
+#include "random.h"
+#include "visible_tiles.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Result {
+    std::string name;
+    std::string parameter;
+    uint64_t batchSize;
+    double nsPerOp;
+    double minNsPerOp;
+};
+
+struct Settings {
+    std::string filter;
+    std::string jsonPath;
+    double minBatchSeconds = 0.2;
+    int repeats = 5;
+};
+
+// Sink for results the compiler must not optimise away.
+volatile uint64_t blackHole = 0;
+
+struct LevelSize {
+    const char* label;
+    size_t rows;
+    size_t columns;
+};
+
+const LevelSize LEVEL_SIZES[] = {
+    {"12x72", 12, 72},
+    {"32x10000", 32, 10000},
+    {"64x100000", 64, 100000},
+};
+
+const size_t ENEMY_COUNTS[] = {1, 10, 100, 1000};
+
+// Same screen the game opens with: 1024x480, so cells are 480 / rows.
+const float SCREEN_WIDTH = 1024.0f;
+const float SCREEN_HEIGHT = 480.0f;
+
+LevelPack::Layout generated(const LevelSize& size, size_t enemies = 0) {
+    LevelGenerator::Parameters parameters;
+    parameters.rows = size.rows;
+    parameters.columns = size.columns;
+    parameters.enemyCount = enemies;
+    return LevelGenerator::generate(parameters);
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs op(i) in batches, doubling the batch until it takes minBatchSeconds,
+// then times REPEATS batches of that size.
+void run(const Settings& settings, const std::string& name, const std::string& parameter,
+         const std::function<void(uint64_t)>& op, std::vector<Result>& results) {
+    std::string fullName = name + "/" + parameter;
+    if (!settings.filter.empty() && fullName.find(settings.filter) == std::string::npos) return;
+
+    uint64_t batch = 1;
+    for (;;) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < batch; i++) op(i);
+        if (secondsSince(start) >= settings.minBatchSeconds || batch >= (1ull << 40)) break;
+        batch *= 2;
+    }
+
+    std::vector<double> samples;
+    for (int repeat = 0; repeat < settings.repeats; repeat++) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < batch; i++) op(i);
+        samples.push_back(secondsSince(start) * 1e9 / batch);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    Result result = {name, parameter, batch, samples[samples.size() / 2], samples.front()};
+    std::printf("%-22s %-10s %14.1f ns/op  (min %.1f, batch %llu)\n", name.c_str(), parameter.c_str(),
+                result.nsPerOp, result.minNsPerOp, static_cast<unsigned long long>(batch));
+    std::fflush(stdout);
+    results.push_back(result);
+}
+
+// Positions spread over the level's open space, fixed by seed.
+std::vector<Vector2> probePositions(const Level& level, size_t count) {
+    Random random(1);
+    std::vector<Vector2> positions;
+    for (size_t i = 0; i < count; i++) {
+        positions.push_back({random.nextFloat(0.0f, static_cast<float>(level.getColumns() - 1)),
+                             random.nextFloat(0.0f, static_cast<float>(level.getRows() - 1))});
+    }
+    return positions;
+}
+
+void benchLevelLoading(const Settings& settings, std::vector<Result>& results) {
+    for (const LevelSize& size : LEVEL_SIZES) {
+        LevelPack pack;
+        pack.addLayout(generated(size));
+        std::string rle = LevelPack::encodeLayout(pack.getLayout(0));
+
+        run(settings, "decode_layout", size.label, [&](uint64_t) {
+            blackHole += LevelPack::decodeLayout(rle).cells.size();
+        }, results);
+
+        Level level;
+        run(settings, "level_load", size.label, [&](uint64_t) {
+            level.load(pack, 0);
+            blackHole += level.getColumns();
+        }, results);
+    }
+}
+
+void benchCollision(const Settings& settings, std::vector<Result>& results) {
+    for (const LevelSize& size : LEVEL_SIZES) {
+        LevelPack pack;
+        pack.addLayout(generated(size));
+        Level level;
+        level.load(pack, 0);
+        std::vector<Vector2> probes = probePositions(level, 4096);
+
+        run(settings, "is_colliding", size.label, [&](uint64_t i) {
+            blackHole += level.isColliding(probes[i % probes.size()], WALL);
+        }, results);
+
+        // getCollider marks every hit cell dirty; reset them now and then,
+        // as loading a level would.
+        std::vector<Level::CellChange> none;
+        run(settings, "get_collider", size.label, [&](uint64_t i) {
+            if (i % probes.size() == 0) level.restoreChanges(none);
+            blackHole += static_cast<unsigned char>(level.getCollider(probes[i % probes.size()], WALL));
+        }, results);
+    }
+}
+
+// Enemies patrolling the widest level, every enemy updated once per op.
+void benchEntities(const Settings& settings, std::vector<Result>& results) {
+    const LevelSize& size = LEVEL_SIZES[2];
+    for (size_t count : ENEMY_COUNTS) {
+        LevelPack pack;
+        pack.addLayout(generated(size, count));
+        Level level;
+        level.load(pack, 0);
+
+        std::vector<Enemy*> enemies;
+        for (size_t row = 0; row < level.getRows(); row++) {
+            for (size_t column = 0; column < level.getColumns(); column++) {
+                if (level.getCell(row, column) == ENEMY) {
+                    enemies.push_back(new Enemy({static_cast<float>(column), static_cast<float>(row)}));
+                }
+            }
+        }
+        std::string parameter = std::to_string(enemies.size());
+
+        run(settings, "enemy_update", parameter, [&](uint64_t) {
+            for (Enemy* enemy : enemies) enemy->update(&level);
+        }, results);
+
+        // The player waits at the spawn, so the cost is the per-enemy
+        // overlap test plus the player's own tile queries and gravity.
+        Player player;
+        player.spawn(&level);
+        Player::State spawned = player.getState();
+        std::vector<GameEvent> events;
+        run(settings, "player_update", parameter, [&](uint64_t i) {
+            player.setState(spawned);
+            events.clear();
+            player.update(&level, enemies, events, i);
+        }, results);
+
+        for (Enemy* enemy : enemies) delete enemy;
+    }
+}
+
+void benchVisibleTiles(const Settings& settings, std::vector<Result>& results) {
+    for (const LevelSize& size : LEVEL_SIZES) {
+        LevelPack pack;
+        pack.addLayout(generated(size));
+        Level level;
+        level.load(pack, 0);
+
+        float cellSize = SCREEN_HEIGHT / static_cast<float>(level.getRows());
+        float horizontalShift = (SCREEN_WIDTH - cellSize) / 2;
+        std::vector<VisibleTile> tiles;
+        run(settings, "visible_tiles", size.label, [&](uint64_t i) {
+            float cameraX = static_cast<float>(i % level.getColumns());
+            collectVisibleTiles(level, cameraX, cellSize, horizontalShift, SCREEN_WIDTH, tiles);
+            blackHole += tiles.size();
+        }, results);
+    }
+}
+
+bool writeJson(const std::string& filename, const std::vector<Result>& results) {
+    FILE* file = std::fopen(filename.c_str(), "w");
+    if (!file) return false;
+    std::fprintf(file, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        std::fprintf(file,
+                     "    {\"name\": \"%s\", \"parameter\": \"%s\", \"batch_size\": %llu, "
+                     "\"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f}%s\n",
+                     result.name.c_str(), result.parameter.c_str(), static_cast<unsigned long long>(result.batchSize),
+                     result.nsPerOp, result.minNsPerOp, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+    return std::fclose(file) == 0;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Settings settings;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            settings.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            settings.jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            settings.minBatchSeconds = 0.01;
+            settings.repeats = 3;
+        } else {
+            std::fprintf(stderr, "Usage: platformer_bench [--filter TEXT] [--json FILE] [--quick]\n");
+            return 2;
+        }
+    }
+
+    std::vector<Result> results;
+    benchLevelLoading(settings, results);
+    benchCollision(settings, results);
+    benchEntities(settings, results);
+    benchVisibleTiles(settings, results);
+
+    if (!settings.jsonPath.empty() && !writeJson(settings.jsonPath, results)) {
+        std::fprintf(stderr, "ERROR could not write %s\n", settings.jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
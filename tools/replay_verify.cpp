@@ -0,0 +1,101 @@
+// Headless regression check for recorded runs: replays each file through the
+// simulation with no window or frame cap and compares the end state (score,
+// lives, level, final frame) with the one stored at record time.
+// Usage: replay_verify [--bless] <replay>...
+// Run from the project root so data/levels.rll resolves.
+
+#include "simulation.h"
+#include "level.h"
+#include "replay.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+void printEndState(const char* label, const Replay::EndState& state) {
+    std::printf("    %-8s score %d, lives %d, level %d, frame %llu\n", label, state.score, state.lives,
+                state.levelIndex, static_cast<unsigned long long>(state.frame));
+}
+
+}
+
+int main(int argc, char** argv) {
+    bool bless = false;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--bless") == 0) {
+            bless = true;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        std::fprintf(stderr, "Usage: replay_verify [--bless] <replay>...\n"
+                             "  --bless  store the replayed end state as the expected one\n");
+        return 2;
+    }
+
+    const uint64_t packHash = Level::hashPack();
+    int failures = 0;
+    uint64_t totalTicks = 0;
+    double totalSeconds = 0.0;
+
+    for (const auto& file : files) {
+        Replay replay;
+        try {
+            replay.load(file);
+        } catch (const ReplayException& e) {
+            std::printf("ERROR %s: %s\n", file.c_str(), e.what());
+            failures++;
+            continue;
+        }
+        if (replay.getLevelPackHash() != packHash) {
+            std::printf("WARN  %s: recorded against a different level pack\n", file.c_str());
+        }
+
+        Simulation simulation(replay.getSeed());
+        InputFrame input;
+        auto start = std::chrono::steady_clock::now();
+        while (replay.next(input)) {
+            simulation.step(input);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        totalTicks += replay.getTickCount();
+        totalSeconds += seconds;
+
+        double ticksPerSecond = seconds > 0.0 ? replay.getTickCount() / seconds : 0.0;
+        Replay::EndState actual = Replay::endStateOf(simulation);
+
+        if (bless) {
+            replay.setEndState(actual);
+            try {
+                replay.save(file);
+            } catch (const ReplayException& e) {
+                std::printf("ERROR %s: %s\n", file.c_str(), e.what());
+                failures++;
+                continue;
+            }
+            std::printf("BLESS %s: %llu ticks\n", file.c_str(), static_cast<unsigned long long>(replay.getTickCount()));
+        } else if (!replay.hasEndState()) {
+            std::printf("SKIP  %s: no expected end state recorded\n", file.c_str());
+        } else if (actual != replay.getEndState()) {
+            std::printf("FAIL  %s: %llu ticks\n", file.c_str(), static_cast<unsigned long long>(replay.getTickCount()));
+            printEndState("expected", replay.getEndState());
+            printEndState("actual", actual);
+            failures++;
+        } else {
+            std::printf("PASS  %s: %llu ticks, %.0f ticks/s (%.0fx realtime)\n", file.c_str(),
+                        static_cast<unsigned long long>(replay.getTickCount()), ticksPerSecond,
+                        ticksPerSecond / TICKS_PER_SECOND);
+        }
+    }
+
+    double ticksPerSecond = totalSeconds > 0.0 ? totalTicks / totalSeconds : 0.0;
+    std::printf("%zu replay(s), %d failure(s), %llu ticks in %.3f s: %.0f ticks/s (%.0fx realtime)\n",
+                files.size(), failures, static_cast<unsigned long long>(totalTicks), totalSeconds,
+                ticksPerSecond, ticksPerSecond / TICKS_PER_SECOND);
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
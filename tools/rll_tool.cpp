@@ -0,0 +1,289 @@
+// Command-line tooling for .rll level packs built on LevelPack's run-length
+// codec. Multi-file commands process their packs in parallel.
+// Usage:
+//   rll_tool encode [grid.txt]                      grid (one row per line) to one RLE line
+//   rll_tool decode <pack.rll>                      every level as a grid
+//   rll_tool validate [--threads N] <pack.rll>...   parse and sanity-check packs
+//   rll_tool compact [--threads N] <pack.rll>...    rewrite packs in canonical form
+//   rll_tool roundtrip [--count N] [--threads N] [--seed S]
+//                                                   randomized decode(encode(x)) == x check
+
+#include "level.h"
+#include "level_pack.h"
+#include "random.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char TILES[] = {WALL, WALL_DARK, AIR, SPIKE, PLAYER, ENEMY, COIN, EXIT};
+
+struct Arguments {
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t count = 100000;
+    uint64_t seed = 1;
+    std::vector<std::string> files;
+};
+
+bool readFile(const std::string& filename, std::string& text) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    text = stream.str();
+    return true;
+}
+
+// Runs job(i) for every i in [0, count) on a pool of threads.
+void parallelFor(size_t count, size_t threads, const std::function<void(size_t)>& job) {
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < std::min(threads, count); t++) {
+        workers.emplace_back([&] {
+            for (size_t i = next++; i < count; i = next++) job(i);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void printThroughput(const char* what, size_t files, size_t bytes, double seconds) {
+    std::printf("%s %zu pack(s), %zu bytes in %.3f s (%.1f MB/s)\n", what, files, bytes, seconds,
+                seconds > 0.0 ? bytes / seconds / 1e6 : 0.0);
+}
+
+int encodeCommand(const Arguments& args) {
+    std::string text;
+    if (args.files.empty()) {
+        std::ostringstream stream;
+        stream << std::cin.rdbuf();
+        text = stream.str();
+    } else if (!readFile(args.files[0], text)) {
+        std::fprintf(stderr, "Could not open %s\n", args.files[0].c_str());
+        return 2;
+    }
+
+    LevelPack::Layout layout = {0, 0, {}};
+    std::vector<std::string> rows;
+    std::istringstream stream(text);
+    std::string row;
+    while (std::getline(stream, row)) {
+        if (!row.empty() && row.back() == '\r') row.pop_back();
+        if (row.empty()) continue;
+        for (char c : row) {
+            if (!LevelPack::isTile(c)) {
+                std::fprintf(stderr, "Unknown tile '%c'\n", c);
+                return 1;
+            }
+        }
+        layout.columns = std::max(layout.columns, row.size());
+        rows.push_back(row);
+    }
+    layout.rows = rows.size();
+    layout.cells.assign(layout.rows * layout.columns, AIR);
+    for (size_t r = 0; r < rows.size(); r++) {
+        std::copy(rows[r].begin(), rows[r].end(), layout.cells.begin() + r * layout.columns);
+    }
+    std::printf("%s\n", LevelPack::encodeLayout(layout).c_str());
+    return 0;
+}
+
+int decodeCommand(const Arguments& args) {
+    if (args.files.size() != 1) return 2;
+    try {
+        LevelPack pack = LevelPack::fromFile(args.files[0]);
+        for (size_t i = 0; i < pack.getLevelCount(); i++) {
+            const LevelPack::Layout& layout = pack.getLayout(static_cast<int>(i));
+            std::printf("; Level %zu (%zux%zu)\n", i + 1, layout.columns, layout.rows);
+            for (size_t row = 0; row < layout.rows; row++) {
+                std::printf("%.*s\n", static_cast<int>(layout.columns), layout.cells.data() + row * layout.columns);
+            }
+        }
+    } catch (const LevelLoadException& e) {
+        std::fprintf(stderr, "%s: %s\n", args.files[0].c_str(), e.what());
+        return 1;
+    }
+    return 0;
+}
+
+// Problems that parse fine but make a level unplayable.
+std::string checkLayout(const LevelPack::Layout& layout) {
+    size_t players = std::count(layout.cells.begin(), layout.cells.end(), PLAYER);
+    size_t exits = std::count(layout.cells.begin(), layout.cells.end(), EXIT);
+    if (players != 1) return std::to_string(players) + " player spawns";
+    if (exits == 0) return "no exit";
+    return "";
+}
+
+struct PackResult {
+    bool ok = false;
+    size_t bytes = 0;
+    size_t canonicalBytes = 0;
+    std::string message;
+};
+
+int processPacks(const Arguments& args, bool compact) {
+    if (args.files.empty()) return 2;
+    std::vector<PackResult> results(args.files.size());
+    auto start = std::chrono::steady_clock::now();
+
+    parallelFor(args.files.size(), args.threads, [&](size_t i) {
+        PackResult& result = results[i];
+        std::string text;
+        if (!readFile(args.files[i], text)) {
+            result.message = "could not open file";
+            return;
+        }
+        result.bytes = text.size();
+        try {
+            LevelPack pack = LevelPack::fromString(text);
+            std::string canonical = pack.toString();
+            result.canonicalBytes = canonical.size();
+            for (size_t level = 0; level < pack.getLevelCount(); level++) {
+                std::string problem = checkLayout(pack.getLayout(static_cast<int>(level)));
+                if (!problem.empty()) {
+                    result.message = "level " + std::to_string(level + 1) + ": " + problem;
+                    return;
+                }
+            }
+            if (compact && canonical != text) {
+                std::ofstream file(args.files[i], std::ios::binary | std::ios::trunc);
+                if (!file.write(canonical.data(), static_cast<std::streamsize>(canonical.size()))) {
+                    result.message = "could not write file";
+                    return;
+                }
+            }
+            result.ok = true;
+            result.message = std::to_string(pack.getLevelCount()) + " level(s)";
+            if (canonical != text) {
+                result.message += compact ? ", rewritten in canonical form" : ", not in canonical form";
+            }
+        } catch (const LevelLoadException& e) {
+            result.message = e.what();
+        }
+    });
+    double seconds = secondsSince(start);
+
+    size_t failures = 0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        const PackResult& result = results[i];
+        bytes += result.bytes;
+        if (!result.ok) failures++;
+        std::printf("%s %s: %s", result.ok ? "OK   " : "ERROR", args.files[i].c_str(), result.message.c_str());
+        if (result.ok && result.canonicalBytes != result.bytes) {
+            std::printf(" (%zu -> %zu bytes)", result.bytes, result.canonicalBytes);
+        }
+        std::printf("\n");
+    }
+    printThroughput(compact ? "Compacted" : "Validated", results.size(), bytes, seconds);
+    return failures == 0 ? 0 : 1;
+}
+
+// Grid made of runs of random tiles and lengths, from single cells to whole
+// rows, so both the digit and the bare-tile paths are exercised.
+LevelPack::Layout randomLayout(Random& random) {
+    LevelPack::Layout layout;
+    layout.rows = 1 + random.next() % 40;
+    layout.columns = 1 + random.next() % 300;
+    layout.cells.resize(layout.rows * layout.columns);
+    for (size_t i = 0; i < layout.cells.size();) {
+        char tile = TILES[random.next() % sizeof(TILES)];
+        size_t run = random.next() % 4 == 0 ? 1 + random.next() % layout.columns : 1 + random.next() % 3;
+        for (size_t j = 0; j < run && i < layout.cells.size(); j++) {
+            layout.cells[i++] = tile;
+        }
+    }
+    return layout;
+}
+
+int roundtripCommand(const Arguments& args) {
+    std::atomic<size_t> failures(0);
+    std::atomic<size_t> cells(0);
+    std::atomic<size_t> encodedBytes(0);
+    auto start = std::chrono::steady_clock::now();
+
+    parallelFor(args.count, args.threads, [&](size_t i) {
+        Random random(args.seed + i);
+        LevelPack::Layout layout = randomLayout(random);
+        std::string encoded = LevelPack::encodeLayout(layout);
+        bool ok = false;
+        try {
+            LevelPack::Layout decoded = LevelPack::decodeLayout(encoded);
+            ok = decoded.rows == layout.rows && decoded.columns == layout.columns && decoded.cells == layout.cells &&
+                 LevelPack::encodeLayout(decoded) == encoded;
+        } catch (const LevelLoadException&) {
+        }
+        if (!ok && failures++ < 10) {
+            std::printf("FAIL  case %zu (seed %llu): %zux%zu grid does not round-trip\n", i,
+                        static_cast<unsigned long long>(args.seed + i), layout.columns, layout.rows);
+        }
+        cells += layout.cells.size();
+        encodedBytes += encoded.size();
+    });
+    double seconds = secondsSince(start);
+
+    std::printf("%zu grid(s), %zu failure(s): %zu cells as %zu RLE bytes (%.1fx), %.3f s (%.1f Mcells/s)\n",
+                args.count, failures.load(), cells.load(), encodedBytes.load(),
+                encodedBytes > 0 ? static_cast<double>(cells) / encodedBytes : 0.0, seconds,
+                seconds > 0.0 ? cells / seconds / 1e6 : 0.0);
+    return failures == 0 ? 0 : 1;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const char* usage =
+        "Usage: rll_tool encode [grid.txt]\n"
+        "       rll_tool decode <pack.rll>\n"
+        "       rll_tool validate [--threads N] <pack.rll>...\n"
+        "       rll_tool compact [--threads N] <pack.rll>...\n"
+        "       rll_tool roundtrip [--count N] [--threads N] [--seed S]\n";
+    if (argc < 2) {
+        std::fprintf(stderr, "%s", usage);
+        return 2;
+    }
+
+    std::string command = argv[1];
+    Arguments args;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            args.threads = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--count" && i + 1 < argc) {
+            args.count = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            args.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            args.files.push_back(arg);
+        }
+    }
+
+    int result = 2;
+    if (command == "encode") {
+        result = encodeCommand(args);
+    } else if (command == "decode") {
+        result = decodeCommand(args);
+    } else if (command == "validate") {
+        result = processPacks(args, false);
+    } else if (command == "compact") {
+        result = processPacks(args, true);
+    } else if (command == "roundtrip") {
+        result = roundtripCommand(args);
+    }
+    if (result == 2) std::fprintf(stderr, "%s", usage);
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,284 @@
+// Finds a fast route through every level with beam search over the real
+// Simulation and writes it as a replay. Each tick, every beam node is
+// restored from its Snapshot, stepped with each distinct input and scored by
+// the walkable distance to the exit (optionally rewarding coins); duplicate
+// states are dropped through a transposition table. The replay's tick count
+// per level gives a par time, and the search itself is a heavy, realistic
+// workload for the simulation hot path.
+// Usage: route_bot [--seed S] [--beam N] [--coins] <output.rep>
+// Run from the project root so data/levels.rll resolves.
+
+#include "simulation.h"
+#include "level.h"
+#include "level_pack.h"
+#include "player.h"
+#include "replay.h"
+#include "snapshot.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct Step {
+    uint32_t parent;
+    uint8_t mask;
+};
+
+struct Node {
+    Snapshot snapshot;
+    uint32_t step;
+    float score;
+};
+
+const uint8_t ACTIONS[6] = {
+    InputFrame::RIGHT_BIT,
+    InputFrame::RIGHT_BIT | InputFrame::JUMP_BIT,
+    0,
+    InputFrame::JUMP_BIT,
+    InputFrame::LEFT_BIT,
+    InputFrame::LEFT_BIT | InputFrame::JUMP_BIT
+};
+
+// Walking distance in cells from every cell to the nearest exit, ignoring
+// jump arcs. Solid cells and cells cut off from the exit are infinite.
+std::vector<float> exitDistances(const LevelPack::Layout& layout) {
+    const float infinity = std::numeric_limits<float>::infinity();
+    std::vector<float> distance(layout.cells.size(), infinity);
+    std::deque<size_t> queue;
+    for (size_t cell = 0; cell < layout.cells.size(); cell++) {
+        if (layout.cells[cell] == EXIT) {
+            distance[cell] = 0.0f;
+            queue.push_back(cell);
+        }
+    }
+    while (!queue.empty()) {
+        size_t cell = queue.front();
+        queue.pop_front();
+        size_t row = cell / layout.columns;
+        size_t column = cell % layout.columns;
+        size_t neighbours[4] = {
+            row > 0 ? cell - layout.columns : cell,
+            row + 1 < layout.rows ? cell + layout.columns : cell,
+            column > 0 ? cell - 1 : cell,
+            column + 1 < layout.columns ? cell + 1 : cell
+        };
+        for (size_t neighbour : neighbours) {
+            if (layout.cells[neighbour] == WALL || distance[neighbour] != infinity) continue;
+            distance[neighbour] = distance[cell] + 1.0f;
+            queue.push_back(neighbour);
+        }
+    }
+    return distance;
+}
+
+uint64_t hashCombine(uint64_t hash, int64_t value) {
+    hash ^= static_cast<uint64_t>(value) + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+// Identifies a state regardless of the tick it was reached on, so reaching
+// it again later is pruned. Enemy positions are left out: they follow the
+// clock rather than the player, and including them would make almost every
+// state unique and collapse the beam onto one spot.
+uint64_t stateKey(const Simulation& simulation, bool coins) {
+    const Player* player = simulation.getPlayer();
+    uint64_t hash = hashCombine(0, simulation.getState());
+    hash = hashCombine(hash, std::lround(player->getPosition().x / PLAYER_MOVEMENT_SPEED));
+    hash = hashCombine(hash, std::lround(player->getPosition().y * 1000.0f));
+    hash = hashCombine(hash, std::lround(player->getState().yVelocity * 1000.0f));
+    hash = hashCombine(hash, player->isOnGround());
+    hash = hashCombine(hash, static_cast<int64_t>(simulation.getEnemies().size()));
+    if (coins) hash = hashCombine(hash, player->getTotalScore());
+    return hash;
+}
+
+float scoreOf(const Simulation& simulation, const LevelPack::Layout& layout, const std::vector<float>& distance,
+              bool coins) {
+    Vector2 position = simulation.getPlayer()->getPosition();
+    long row = std::lround(position.y);
+    long column = std::lround(position.x);
+    float score = std::numeric_limits<float>::infinity();
+    if (row >= 0 && row < static_cast<long>(layout.rows) && column >= 0 && column < static_cast<long>(layout.columns)) {
+        score = distance[row * layout.columns + column];
+    }
+    if (coins) score -= 4.0f * simulation.getPlayer()->getTotalScore();
+    return score;
+}
+
+class RouteBot {
+public:
+    RouteBot(uint64_t seed, size_t beamWidth, bool coins)
+        : simulation(seed), beamWidth(beamWidth), coins(coins), expansions(0) {}
+
+    // Appends the inputs of a route through the current level to `inputs`
+    // and leaves the simulation on the exit. Returns false when no route
+    // was found within the level timer.
+    bool solveLevel(std::vector<uint8_t>& inputs) {
+        const LevelPack::Layout& layout = LevelPack::standard().getLayout(simulation.getLevelIndex());
+        std::vector<float> distance = exitDistances(layout);
+
+        steps.assign(1, {0, 0});
+        seen.clear();
+        beam.resize(1);
+        simulation.saveState(beam[0].snapshot);
+        beam[0].step = 0;
+        size_t beamSize = 1;
+
+        for (int tick = 0; tick < MAX_LEVEL_TIME && beamSize > 0; tick++) {
+            size_t childCount = 0;
+            for (size_t i = 0; i < beamSize; i++) {
+                const Node& node = beam[i];
+                for (uint8_t mask : ACTIONS) {
+                    // Jumping only differs from not jumping on the ground.
+                    if ((mask & InputFrame::JUMP_BIT) && !node.snapshot.player.onGround) continue;
+
+                    simulation.restoreState(node.snapshot);
+                    simulation.step(InputFrame::fromMask(mask));
+                    expansions++;
+
+                    Simulation::GameState state = simulation.getState();
+                    if (state == Simulation::DEATH_STATE) continue;
+                    if (!seen.insert(stateKey(simulation, coins)).second) continue;
+
+                    steps.push_back({node.step, mask});
+                    if (state == Simulation::LEVEL_TRANSITION_STATE) {
+                        appendPath(static_cast<uint32_t>(steps.size() - 1), inputs);
+                        return true;
+                    }
+
+                    if (childCount == children.size()) children.emplace_back();
+                    Node& child = children[childCount++];
+                    simulation.saveState(child.snapshot);
+                    child.step = static_cast<uint32_t>(steps.size() - 1);
+                    child.score = scoreOf(simulation, layout, distance, coins);
+                }
+            }
+
+            beamSize = std::min(childCount, beamWidth);
+            std::partial_sort(children.begin(), children.begin() + beamSize, children.begin() + childCount,
+                              [](const Node& a, const Node& b) { return a.score < b.score; });
+            if (beam.size() < beamSize) beam.resize(beamSize);
+            for (size_t i = 0; i < beamSize; i++) {
+                std::swap(beam[i], children[i]);
+            }
+        }
+        return false;
+    }
+
+    Simulation& getSimulation() { return simulation; }
+    uint64_t getExpansions() const { return expansions; }
+
+private:
+    void appendPath(uint32_t step, std::vector<uint8_t>& inputs) const {
+        size_t start = inputs.size();
+        for (; step != 0; step = steps[step].parent) {
+            inputs.push_back(steps[step].mask);
+        }
+        std::reverse(inputs.begin() + start, inputs.end());
+    }
+
+    Simulation simulation;
+    size_t beamWidth;
+    bool coins;
+    uint64_t expansions;
+
+    std::vector<Step> steps;
+    std::unordered_set<uint64_t> seen;
+    std::vector<Node> beam;
+    std::vector<Node> children;
+};
+
+}
+
+int main(int argc, char** argv) {
+    uint64_t seed = 1;
+    size_t beamWidth = 256;
+    bool coins = false;
+    std::string output;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--seed" && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--beam" && i + 1 < argc) {
+            beamWidth = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--coins") {
+            coins = true;
+        } else if (output.empty() && arg.rfind("--", 0) != 0) {
+            output = arg;
+        } else {
+            output.clear();
+            break;
+        }
+    }
+    if (output.empty()) {
+        std::fprintf(stderr, "Usage: route_bot [--seed S] [--beam N] [--coins] <output.rep>\n"
+                             "  --coins  trade time for collected coins\n");
+        return 2;
+    }
+
+    RouteBot bot(seed, beamWidth, coins);
+    Simulation& simulation = bot.getSimulation();
+    std::vector<uint8_t> inputs;
+
+    // Start the run from the menu.
+    inputs.push_back(InputFrame::ENTER_BIT);
+    simulation.step(InputFrame::fromMask(InputFrame::ENTER_BIT));
+
+    auto start = std::chrono::steady_clock::now();
+    for (int level = 0; level < LEVEL_COUNT; level++) {
+        size_t levelStart = inputs.size();
+        size_t exitTicks = 0;
+        int score = 0;
+        auto searchStart = std::chrono::steady_clock::now();
+
+        // A route can touch the exit mid-jump and fall off it again while
+        // the exit timer drains, so keep searching until the level advances.
+        while (simulation.getLevelIndex() == level && simulation.getState() != Simulation::MENU_STATE) {
+            if (simulation.getState() == Simulation::LEVEL_TRANSITION_STATE) {
+                inputs.push_back(0);
+                simulation.step(InputFrame());
+            } else if (bot.solveLevel(inputs)) {
+                if (exitTicks == 0) {
+                    exitTicks = inputs.size() - levelStart;
+                    score = simulation.getPlayer()->getTotalScore();
+                }
+            } else {
+                std::printf("FAIL  level %d: no route found within the level timer\n", level + 1);
+                return 1;
+            }
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - searchStart).count();
+        size_t levelTicks = inputs.size() - levelStart;
+        std::printf("PASS  level %d: exit reached in %zu ticks (%.2f s), level done in %zu, score %d, search %.3f s\n",
+                    level + 1, exitTicks, exitTicks / static_cast<double>(TICKS_PER_SECOND), levelTicks,
+                    score, seconds);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Replay replay;
+    replay.reset(seed, Level::hashPack());
+    for (uint8_t mask : inputs) {
+        replay.record(InputFrame::fromMask(mask));
+    }
+    replay.setEndState(Replay::endStateOf(simulation));
+    try {
+        replay.save(output);
+    } catch (const ReplayException& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 2;
+    }
+
+    std::printf("%zu ticks written to %s, %llu expansions in %.3f s (%.0f ticks/s)\n", inputs.size(), output.c_str(),
+                static_cast<unsigned long long>(bot.getExpansions()), seconds,
+                seconds > 0.0 ? bot.getExpansions() / seconds : 0.0);
+    return 0;
+}
\ No newline at end of file
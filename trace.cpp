@@ -0,0 +1,150 @@
+#include "trace.h"
+#include <atomic>
+#include <cstring>
+
+Tracer::Tracer() : file(nullptr), eventCount(0), firstEvent(true), stopping(false) {}
+
+Tracer::~Tracer() {
+    close();
+}
+
+bool Tracer::open(const std::string& filename) {
+    close();
+    file = std::fopen(filename.c_str(), "w");
+    if (!file) return false;
+
+    origin = Clock::now();
+    eventCount = 0;
+    firstEvent = true;
+    stopping = false;
+    current.reserve(CHUNK_EVENTS);
+    spares.resize(SPARE_CHUNKS);
+    for (Chunk& chunk : spares) chunk.reserve(CHUNK_EVENTS);
+    pending.reserve(SPARE_CHUNKS + 1);
+
+    std::fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    writer = std::thread(&Tracer::writerLoop, this);
+    return true;
+}
+
+void Tracer::close() {
+    if (!file) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!current.empty()) {
+            pending.push_back(std::move(current));
+            current = Chunk();
+        }
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+
+    std::fprintf(file, "\n]}\n");
+    std::fclose(file);
+    file = nullptr;
+    pending.clear();
+    spares.clear();
+}
+
+uint32_t Tracer::threadId() {
+    static std::atomic<uint32_t> nextId(1);
+    static thread_local uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+Tracer::Event& Tracer::append(const char* name, const char* category, char type, const char* detail) {
+    if (current.size() == CHUNK_EVENTS) handOff();
+    current.emplace_back();
+    Event& event = current.back();
+    event.name = name;
+    event.category = category;
+    event.type = type;
+    event.thread = threadId();
+    event.detail[0] = '\0';
+    if (detail) {
+        std::strncpy(event.detail, detail, DETAIL_LENGTH - 1);
+        event.detail[DETAIL_LENGTH - 1] = '\0';
+    }
+    eventCount++;
+    return event;
+}
+
+void Tracer::complete(const char* name, const char* category, Clock::time_point start, Clock::time_point end,
+                      const char* detail) {
+    if (!file) return;
+    Event& event = append(name, category, 'X', detail);
+    event.startNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin).count());
+    event.durationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void Tracer::instant(const char* name, const char* category, const char* detail) {
+    if (!file) return;
+    Event& event = append(name, category, 'i', detail);
+    event.startNs =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin).count());
+    event.durationNs = 0;
+}
+
+size_t Tracer::getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t events = current.capacity();
+    for (const Chunk& chunk : pending) events += chunk.capacity();
+    for (const Chunk& chunk : spares) events += chunk.capacity();
+    return events * sizeof(Event);
+}
+
+void Tracer::handOff() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(std::move(current));
+        if (!spares.empty()) {
+            current = std::move(spares.back());
+            spares.pop_back();
+        } else {
+            current = Chunk();
+        }
+    }
+    wake.notify_one();
+    // Only allocates when the writer has fallen SPARE_CHUNKS chunks behind.
+    current.reserve(CHUNK_EVENTS);
+}
+
+void Tracer::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) break;
+
+        Chunk chunk = std::move(pending.front());
+        pending.erase(pending.begin());
+        lock.unlock();
+        writeChunk(chunk);
+        chunk.clear();
+        lock.lock();
+        spares.push_back(std::move(chunk));
+    }
+}
+
+void Tracer::writeChunk(const Chunk& chunk) {
+    for (const Event& event : chunk) {
+        std::fprintf(file, "%s{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"%c\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f",
+                     firstEvent ? "" : ",\n", event.name, event.category, event.type, event.thread,
+                     event.startNs / 1e3);
+        firstEvent = false;
+        if (event.type == 'X') {
+            std::fprintf(file, ", \"dur\": %.3f", event.durationNs / 1e3);
+        } else {
+            std::fprintf(file, ", \"s\": \"t\"");
+        }
+        if (event.detail[0] != '\0') {
+            std::fprintf(file, ", \"args\": {\"detail\": \"");
+            for (const char* c = event.detail; *c; c++) {
+                if (*c == '"' || *c == '\\') std::fputc('\\', file);
+                if (static_cast<unsigned char>(*c) >= 0x20) std::fputc(*c, file);
+            }
+            std::fprintf(file, "\"}");
+        }
+        std::fprintf(file, "}");
+    }
+}
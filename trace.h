@@ -0,0 +1,118 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Chrome trace-event recording, viewable in ui.perfetto.dev or
+// chrome://tracing. Events are appended to fixed-size chunks in memory; a
+// full chunk is handed to a background thread that formats and writes it
+// while the recording thread carries on with a recycled chunk, so tracing a
+// long session costs a few stores per event and never waits on the disk.
+//
+// Like the Profiler, instrumented code reaches the tracer through a
+// thread-local pointer, so only the thread that installed it records and
+// threads that never install one pay a single branch per TRACE_SCOPE. Names
+// and categories must be string literals; the optional detail text is copied.
+class Tracer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t CHUNK_EVENTS = 4096;
+    // Chunks allocated up front; more are only made if the writer falls behind.
+    static constexpr size_t SPARE_CHUNKS = 4;
+    static constexpr size_t DETAIL_LENGTH = 64;
+
+    Tracer();
+    ~Tracer();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    // Starts the writer thread; false when the file cannot be created.
+    bool open(const std::string& filename);
+    // Writes every buffered event, finishes the JSON and joins the writer.
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    // A span that has already ended ("X" event).
+    void complete(const char* name, const char* category, Clock::time_point start, Clock::time_point end,
+                  const char* detail = nullptr);
+    // A point in time ("i" event).
+    void instant(const char* name, const char* category, const char* detail = nullptr);
+
+    uint64_t getEventCount() const { return eventCount; }
+    // Event storage across the current, pending and spare chunks.
+    size_t getMemoryUsage() const;
+
+    static Tracer* active() { return activeTracer; }
+    static void setActive(Tracer* tracer) { activeTracer = tracer; }
+
+private:
+    struct Event {
+        const char* name;
+        const char* category;
+        char type;
+        uint32_t thread;
+        uint64_t startNs;
+        uint64_t durationNs;
+        char detail[DETAIL_LENGTH];
+    };
+    using Chunk = std::vector<Event>;
+
+    Event& append(const char* name, const char* category, char type, const char* detail);
+    void handOff();
+    void writerLoop();
+    void writeChunk(const Chunk& chunk);
+    static uint32_t threadId();
+
+    FILE* file;
+    Clock::time_point origin;
+    Chunk current;
+    uint64_t eventCount;
+    bool firstEvent;
+
+    std::thread writer;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<Chunk> pending;
+    std::vector<Chunk> spares;
+    bool stopping;
+
+    static inline thread_local Tracer* activeTracer = nullptr;
+};
+
+// Records the enclosing block as a span of the active tracer.
+class TraceScope {
+public:
+    TraceScope(const char* name, const char* category, const char* detail = nullptr)
+        : tracer(Tracer::active()), name(name), category(category), detail(detail) {
+        if (tracer) start = Tracer::Clock::now();
+    }
+    ~TraceScope() {
+        if (tracer) tracer->complete(name, category, start, Tracer::Clock::now(), detail);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    Tracer* tracer;
+    const char* name;
+    const char* category;
+    const char* detail;
+    Tracer::Clock::time_point start;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(...) TraceScope TRACE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
+
+#endif // TRACE_H
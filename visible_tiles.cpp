@@ -0,0 +1,35 @@
+#include "visible_tiles.h"
+#include "level.h"
+#include <algorithm>
+#include <cmath>
+
+void collectVisibleTiles(const Level& level, float cameraX, float cellSize, float horizontalShift, float screenWidth,
+                         std::vector<VisibleTile>& tiles) {
+    tiles.clear();
+    if (cellSize <= 0.0f || !level.isLoaded()) return;
+
+    // Columns whose cell overlaps [0, screenWidth), with a column of slack.
+    float firstVisible = std::floor(cameraX - horizontalShift / cellSize) - 1.0f;
+    float lastVisible = std::ceil(cameraX + (screenWidth - horizontalShift) / cellSize) + 1.0f;
+    float columns = static_cast<float>(level.getColumns());
+    size_t first = static_cast<size_t>(std::min(std::max(firstVisible, 0.0f), columns));
+    size_t last = static_cast<size_t>(std::min(std::max(lastVisible, 0.0f), columns));
+
+    // Sized for a full screen of tiles up front, so scrolling onto denser
+    // columns never grows the list mid-level.
+    size_t windowColumns = static_cast<size_t>(std::ceil(screenWidth / cellSize)) + 4;
+    tiles.reserve(level.getRows() * std::min(windowColumns, level.getColumns()));
+
+    for (size_t row = 0; row < level.getRows(); ++row) {
+        for (size_t column = first; column < last; ++column) {
+            char cell = level.getCell(row, column);
+            if (cell == WALL || cell == WALL_DARK || cell == SPIKE || cell == COIN || cell == EXIT) {
+                Vector2 position = {
+                    (static_cast<float>(column) - cameraX) * cellSize + horizontalShift,
+                    static_cast<float>(row) * cellSize
+                };
+                tiles.push_back({position, cell});
+            }
+        }
+    }
+}
\ No newline at end of file
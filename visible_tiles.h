@@ -0,0 +1,22 @@
+#ifndef VISIBLE_TILES_H
+#define VISIBLE_TILES_H
+
+#include "raylib.h"
+#include <vector>
+
+class Level;
+
+struct VisibleTile {
+    Vector2 position;
+    char tile;
+};
+
+// The CPU half of Graphics::drawGame: screen positions of every drawable
+// tile (walls, spikes, coins, exits) that overlaps the screen for a camera
+// centred on cameraX. Only on-screen columns are scanned, so the cost
+// follows the screen width rather than the level width. Kept free of raylib
+// calls so platformer_bench can time it without a window.
+void collectVisibleTiles(const Level& level, float cameraX, float cellSize, float horizontalShift, float screenWidth,
+                         std::vector<VisibleTile>& tiles);
+
+#endif // VISIBLE_TILES_H
\ No newline at end of file